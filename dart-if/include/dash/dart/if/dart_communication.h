@@ -210,6 +210,103 @@ dart_ret_t dart_alltoall(
   dart_datatype_t  dtype,
   dart_team_t      team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param nsendelem   Array containing the number of values to send to each
+ *                    unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param team        The team to participate in the alltoallv.
+ *
+ * Counts and displacements are given in elements of type \c dtype and
+ * must not exceed INT_MAX.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Scan, an inclusive prefix reduction over the
+ * units in \c team.
+ * After completion, \c recvbuf on unit \c i contains the element-wise
+ * reduction of the values in \c sendbuf on units \c 0, ..., \c i.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ *                If \c sendbuf is \c NULL or equal to \c recvbuf, the input
+ *                is taken from \c recvbuf.
+ * \param recvbuf Buffer of size \c nelem to store the result in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and
+ *                \c recvbuf.
+ *                The value of this parameter must not execeed INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param op      The reduction operation to perform, either predefined or
+ *                created using \ref dart_op_create.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_scan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Exscan, an exclusive prefix reduction over the
+ * units in \c team.
+ * After completion, \c recvbuf on unit \c i > 0 contains the element-wise
+ * reduction of the values in \c sendbuf on units \c 0, ..., \c i-1.
+ * The content of \c recvbuf on unit \c 0 is undefined.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ *                If \c sendbuf is \c NULL or equal to \c recvbuf, the input
+ *                is taken from \c recvbuf.
+ * \param recvbuf Buffer of size \c nelem to store the result in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and
+ *                \c recvbuf.
+ *                The value of this parameter must not execeed INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param op      The reduction operation to perform, either predefined or
+ *                created using \ref dart_op_create.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI_Reduce.
  *
@@ -299,6 +396,32 @@ dart_ret_t dart_accumulate_blocking_local(
   dart_datatype_t  dtype,
   dart_operation_t op) DART_NOTHROW;
 
+/**
+ * Perform an atomic update on the single value of type \c dtype pointed to
+ * by \c gptr by applying the operation \c op with \c value on it.
+ *
+ * In contrast to \ref dart_accumulate, \c value is copied and can be reused
+ * as soon as the call returns, so that a large number of updates can be
+ * issued without waiting for any of them. The update is only guaranteed to
+ * be complete after a subsequent flush on \c gptr.
+ *
+ * \param gptr    A global pointer determining the target of the accumulate
+ *                operation.
+ * \param value   The value to accumulate.
+ * \param dtype   The basic data type to use in the accumulate operation.
+ * \param op      The accumulation operation to perform.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_accumulate_deferred(
+  dart_gptr_t      gptr,
+  const void     * value,
+  dart_datatype_t  dtype,
+  dart_operation_t op) DART_NOTHROW;
+
 /**
  * Perform an element-wise atomic update on the value of type \c dtype pointed
  * to by \c gptr by applying the operation \c op with \c value on it and
@@ -364,6 +487,106 @@ dart_ret_t dart_compare_and_swap(
 /** \} */
 
 
+/**
+ * \name Aggregated atomic updates
+ * Buffering of fine-grained element-wise atomic updates that are
+ * shipped to their target units in batches.
+ *
+ * Updates are buffered per target unit. Once the buffer of a target holds
+ * \c threshold updates, all of them are issued in a single accumulate
+ * operation. Updates of the same element within a batch are combined
+ * at the origin. Completion of all buffered updates is guaranteed after
+ * \ref dart_aggregator_flush.
+ *
+ * Only non-fetching operations can be aggregated, see
+ * \ref dart_fetch_and_op for updates that require the previous value.
+ */
+/** \{ */
+
+/**
+ * Opaque type of an aggregator of atomic updates.
+ */
+typedef struct dart_aggregator_struct * dart_aggregator_t;
+
+/**
+ * Create an aggregator for element-wise atomic updates of type \c dtype
+ * applying the operation \c op on global memory allocated in team \c team.
+ *
+ * \param team      The team of all global pointers passed to
+ *                  \ref dart_aggregator_add.
+ * \param dtype     The basic data type of the updated elements.
+ * \param op        The pre-defined operation to apply at the target.
+ *                  \ref DART_OP_NO_OP is not supported.
+ * \param threshold The number of buffered updates per target unit
+ *                  that triggers shipping them, or \c 0 to use a
+ *                  default.
+ * \param[out] agg  The new aggregator.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregator_create(
+  dart_team_t         team,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  size_t              threshold,
+  dart_aggregator_t * agg) DART_NOTHROW;
+
+/**
+ * Buffer an atomic update of the single element referenced by \c gptr
+ * with \c value. The value is copied and \c value can be reused
+ * immediately.
+ * May ship the buffered updates of the target unit of \c gptr if its
+ * buffer is full.
+ *
+ * \param agg    The aggregator to buffer the update in.
+ * \param gptr   A global pointer to the element to update.
+ * \param value  Pointer to the operand of the update.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregator_add(
+  dart_aggregator_t   agg,
+  dart_gptr_t         gptr,
+  const void        * value) DART_NOTHROW;
+
+/**
+ * Ship all buffered updates and wait for their completion at the targets.
+ * Updates of other units are only guaranteed to be visible after
+ * a subsequent synchronization such as \ref dart_barrier.
+ *
+ * \param agg    The aggregator to flush.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregator_flush(
+  dart_aggregator_t   agg) DART_NOTHROW;
+
+/**
+ * Flush and release an aggregator.
+ *
+ * \param agg    Pointer to the aggregator to release, set to \c NULL on
+ *               return.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregator_destroy(
+  dart_aggregator_t * agg) DART_NOTHROW;
+
+/** \} */
+
+
 /**
  * \name Non-blocking single-sided communication routines
  * DART single-sided communication routines that return without guaranteeing
@@ -716,6 +939,387 @@ dart_ret_t dart_handle_free(
 
 /** \} */
 
+/**
+ * \name Handle groups
+ * Completion of many non-blocking single-sided operations at once.
+ *
+ * The requests of operations issued on a group are collected in an array
+ * owned by the group, so that completing all of them requires a single
+ * wait or test call and no handle has to be allocated per operation.
+ * A group can be reused after its operations have been completed.
+ */
+
+/** \{ */
+
+/**
+ * Opaque type of a group of non-blocking operations.
+ */
+typedef struct dart_handle_group_struct * dart_handle_group_t;
+
+#define DART_HANDLE_GROUP_NULL (dart_handle_group_t)NULL
+
+/**
+ * Create an empty handle group.
+ *
+ * \param capacity   The number of operations the group is expected to
+ *                   hold, the group grows beyond that on demand.
+ * \param[out] group The new handle group.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_create(
+  size_t                capacity,
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_get adding the operation to \c group instead of
+ * returning a handle.
+ *
+ * \param group     The group to add the operation to.
+ * \param dest      Local target memory to store the data.
+ * \param gptr      Global pointer being the source of the data transfer.
+ * \param nelem     The number of elements of \c dtype in buffer \c dest.
+ * \param src_type  The data type of the values at the source.
+ * \param dst_type  The data type of the values in buffer \c dest.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_get(
+  dart_handle_group_t   group,
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_put adding the operation to \c group instead of
+ * returning a handle.
+ *
+ * \param group     The group to add the operation to.
+ * \param gptr      Global pointer being the target of the data transfer.
+ * \param src       Local source memory to transfer data from.
+ * \param nelem     The number of elements of type \c dtype to transfer.
+ * \param src_type  The data type of the values in buffer \c src.
+ * \param dst_type  The data type of the values at the target.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_put(
+  dart_handle_group_t   group,
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type) DART_NOTHROW;
+
+/**
+ * Move the operation referenced by \c handle into \c group.
+ * The handle is released and set to \ref DART_HANDLE_NULL.
+ * Handles of non-blocking v-collectives cannot be added to a group.
+ *
+ * \param group     The group to add the operation to.
+ * \param handle    The handle of a non-blocking single-sided operation.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_add(
+  dart_handle_group_t   group,
+  dart_handle_t       * handle) DART_NOTHROW;
+
+/**
+ * Wait for the local and remote completion of all operations in
+ * \c group. The group is empty afterwards.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_wait(
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Wait for the local completion of all operations in \c group.
+ * The group is empty afterwards.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_wait_local(
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Test for the completion of all operations in \c group and ensure their
+ * remote completion. The group is empty if all operations completed.
+ *
+ * \param group            The group to test.
+ * \param[out] is_finished \c True if all operations have completed.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_test(
+  dart_handle_group_t   group,
+  int32_t             * is_finished) DART_NOTHROW;
+
+/**
+ * Test for the local completion of all operations in \c group.
+ * The group is empty if all operations completed.
+ *
+ * \param group            The group to test.
+ * \param[out] is_finished \c True if all operations have completed.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_test_local(
+  dart_handle_group_t   group,
+  int32_t             * is_finished) DART_NOTHROW;
+
+/**
+ * Release a handle group without waiting for the completion of its
+ * operations.
+ *
+ * \param group Pointer to the group to release, set to
+ *              \ref DART_HANDLE_GROUP_NULL on return.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_destroy(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/** \} */
+
+/**
+ * \name Non-blocking collective operations
+ * Collective operations that return immediately and provide a handle to
+ * be used with \c dart_wait, \c dart_test and their variants.
+ * The buffers passed to these operations must not be accessed until
+ * the operation has been completed.
+ * Handles of non-blocking collectives must not be released using
+ * \ref dart_handle_free before completion.
+ */
+
+/** \{ */
+
+/**
+ * DART Equivalent to MPI_Ibarrier.
+ *
+ * \param team        The team to perform a barrier on.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ibcast.
+ *
+ * \param buf         Buffer that is the source (on \c root) or the
+ *                    destination of the broadcast.
+ * \param nelem       The number of values to broadcast/receive.
+ *                    The value of this parameter must not execeed INT_MAX.
+ * \param dtype       The data type of values in \c buf.
+ * \param root        The unit that broadcasts data to all other members in
+ *                    \c team
+ * \param team        The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Iallgather.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nelem       Number of values sent by each process and received from
+ *                    each unit.
+ *                    The value of this parameter must not execeed INT_MAX.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param team        The team to participate in the allgather.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Iallgatherv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param nsendelem   Number of values to be sent by this unit.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the allgatherv.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * The arrays \c nrecvelem and \c recvdispls may be released or reused
+ * immediately after the call returns.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgatherv(
+  const void      * sendbuf,
+  size_t            nsendelem,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Iallreduce.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nelem       Number of elements sent by each process and received
+ *                    from each unit.
+ *                    The value of this parameter must not execeed INT_MAX.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf to
+ *                    use in \c op.
+ * \param op          The reduction operation to perform.
+ * \param team        The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team,
+  dart_handle_t  * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ialltoall.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nelem       Number of elements sent by each process and received
+ *                    from each unit.
+ *                    The value of this parameter must not execeed INT_MAX.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param team        The team to participate in the alltoall.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ialltoall(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_team_t      team,
+  dart_handle_t  * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ialltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param nsendelem   Array containing the number of values to send to each
+ *                    unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param team        The team to participate in the alltoallv.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * The count and displacement arrays may be released or reused immediately
+ * after the call returns.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ialltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
@@ -771,6 +1375,116 @@ dart_ret_t dart_put_blocking(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type) DART_NOTHROW;
 
+/**
+ * Vectored variant of \ref dart_get_blocking, reading \c nelem elements
+ * from each of the \c num global addresses in \c gptrs into the local
+ * buffers in \c dest.
+ *
+ * Transfers are grouped by target unit and segment. Transfers to the same
+ * target are sorted by offset, adjacent ranges are merged and issued as a
+ * single operation.
+ * Local completion is guaranteed.
+ *
+ * \param dest   Array of \c num local buffers to store the data.
+ * \param gptrs  Array of \c num global pointers to read from.
+ * \param num    The number of transfers.
+ * \param nelem  The number of elements of type \c dtype per transfer.
+ * \param dtype  The contiguous data type of the values to transfer.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_getv(
+  void            * const dest[],
+  const dart_gptr_t       gptrs[],
+  size_t                  num,
+  size_t                  nelem,
+  dart_datatype_t         dtype) DART_NOTHROW;
+
+/**
+ * Vectored variant of \ref dart_put_blocking, writing \c nelem elements
+ * from each of the \c num local buffers in \c src to the global addresses
+ * in \c gptrs.
+ *
+ * Transfers are grouped by target unit and segment. Transfers to the same
+ * target are sorted by offset, adjacent ranges are merged and issued as a
+ * single operation. The target ranges must not overlap.
+ * Both local and remote completion is guaranteed.
+ *
+ * \param gptrs  Array of \c num global pointers to write to.
+ * \param src    Array of \c num local buffers to transfer data from.
+ * \param num    The number of transfers.
+ * \param nelem  The number of elements of type \c dtype per transfer.
+ * \param dtype  The contiguous data type of the values to transfer.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_putv(
+  const dart_gptr_t       gptrs[],
+  const void      * const src[],
+  size_t                  num,
+  size_t                  nelem,
+  dart_datatype_t         dtype) DART_NOTHROW;
+
+/**
+ * Write \c nelem elements from \c src to the global memory referenced by
+ * \c gptr and notify the target afterwards by atomically adding \c value
+ * to the 64 bit notification counter referenced by \c notify_gptr.
+ *
+ * The notification becomes visible only after the payload has been
+ * written at the target, so that a consumer waiting for the counter
+ * using \ref dart_notify_wait can safely access the payload without any
+ * further synchronization.
+ * The local buffer \c src can be reused once the call returns.
+ *
+ * \param gptr        Global pointer being the target of the data transfer.
+ * \param src         Local source memory to transfer data from.
+ * \param nelem       The number of elements of type \c dtype to transfer.
+ * \param dtype       The data type of the values in buffer \c src.
+ * \param notify_gptr Global pointer referencing an \c int64_t counter,
+ *                    usually located at the unit targeted by \c gptr.
+ * \param value       The value to add to the notification counter.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_gptr_t       notify_gptr,
+  int64_t           value) DART_NOTHROW;
+
+/**
+ * Wait until the \c int64_t notification counter referenced by
+ * \c counter reaches at least the value \c expected.
+ *
+ * The counter has to be located in the memory of the calling unit, the
+ * wait does not involve any remote communication.
+ * Payloads of all \ref dart_put_notify operations whose notifications
+ * have been observed are visible once the call returns.
+ *
+ * \param counter     Global pointer referencing the local notification
+ *                    counter.
+ * \param expected    The counter value to wait for.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_notify_wait(
+  dart_gptr_t       counter,
+  int64_t           expected) DART_NOTHROW;
+
 /** \} */
 
 
@@ -858,6 +1572,67 @@ dart_ret_t dart_sendrecv(
   int                  recv_tag,
   dart_global_unit_t   src) DART_NOTHROW;
 
+/**
+ * Check for an incoming message with tag \c tag from any unit without
+ * blocking. DART Equivalent to MPI iprobe with \c MPI_ANY_SOURCE.
+ *
+ * If a matching message is pending, it can be received with \ref dart_recv
+ * from the unit returned in \c unit.
+ *
+ * \param tag     Message tag of the message to check for.
+ * \param unit    Set to the unit sending the message, if any.
+ * \param nbytes  Set to the size of the message in bytes, if any.
+ * \param flag    Set to a non-zero value if a matching message is pending,
+ *                zero otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_probe(
+  int                  tag,
+  dart_global_unit_t * unit,
+  size_t             * nbytes,
+  int32_t            * flag) DART_NOTHROW;
+
+
+/** \} */
+
+/**
+ * \name Non-blocking two-sided communication operations
+ * These operations return immediately and provide a handle to be used
+ * with \c dart_wait, \c dart_test and their variants.
+ * The buffers passed to these operations must not be accessed until
+ * the operation has been completed.
+ */
+
+/** \{ */
+
+/**
+ * DART Equivalent to MPI isend.
+ *
+ * \param sendbuf     Buffer containing the data to be sent by the unit.
+ * \param nelem       Number of values sent to the specified unit.
+ * \param dtype       The data type of values in \c sendbuf.
+ * \param tag         Message tag for the distinction between different
+ *                    messages.
+ * \param unit        Unit the message is sent to.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_isend(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handle) DART_NOTHROW;
 
 /** \} */
 
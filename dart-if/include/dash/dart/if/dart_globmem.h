@@ -223,6 +223,24 @@ dart_ret_t dart_gptr_setunit(
   return DART_OK;
 }
 
+/**
+ * Segment flag to perform \ref dart_accumulate, \ref dart_fetch_and_op
+ * and \ref dart_compare_and_swap on integral types through processor
+ * atomics if the target memory is directly accessible, i.e., if it is
+ * located at the calling unit or a unit on the same node.
+ *
+ * Processor atomics are not atomic with respect to MPI atomics issued
+ * from other nodes, so the flag should only be set if all units updating
+ * the memory are located on the same node. It has to be set by all units
+ * accessing the segment. Node-local atomic operations are complete on
+ * return and are not ordered with respect to pending operations of the
+ * calling unit.
+ *
+ * \see dart_gptr_setflags
+ * \ingroup DartGlobMem
+ */
+#define DART_GPTR_FLAG_SHMEM_ATOMICS ((uint16_t)(1 << 1))
+
 /**
  * Get the flags field for the segment specified by the global pointer.
  *
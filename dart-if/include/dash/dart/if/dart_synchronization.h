@@ -63,6 +63,46 @@ dart_ret_t dart_team_lock_init(
 dart_ret_t dart_team_lock_destroy(
   dart_lock_t * lock)   DART_NOTHROW;
 
+/**
+ * Collective operation to initialize \c num_locks locks at once.
+ *
+ * The locks share a single allocation of global memory, so the cost of
+ * the initialization does not grow with the number of locks as with
+ * repeated calls to \ref dart_team_lock_init. The locks are hosted by the
+ * units of the team in a round-robin fashion, i.e., lock \c i is hosted
+ * by unit \c i modulo the team size.
+ *
+ * \param teamid    Team the locks are used for.
+ * \param num_locks The number of locks to initialize.
+ * \param[out] locks Array of \c num_locks locks to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_lock_array_init(
+  dart_team_t   teamid,
+  size_t        num_locks,
+  dart_lock_t * locks)  DART_NOTHROW;
+
+/**
+ * Collective operation to destroy the locks initialized using
+ * \ref dart_team_lock_array_init. The locks of a lock array cannot be
+ * destroyed individually using \ref dart_team_lock_destroy.
+ *
+ * \param num_locks The number of locks in the array.
+ * \param locks     The array of locks to free.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_lock_array_destroy(
+  size_t        num_locks,
+  dart_lock_t * locks)  DART_NOTHROW;
+
 /**
  * Block until the \c lock was acquired.
  *
@@ -125,6 +165,137 @@ dart_ret_t dart_lock_release(
 bool dart_lock_initialized(
     struct dart_lock_struct const *lock) DART_NOTHROW;
 
+/**
+ * Reader-writer lock type allowing either a single writer or any number
+ * of readers among the units in a team.
+ * \ingroup DartSync
+ */
+typedef struct dart_rwlock_struct *dart_rwlock_t;
+
+/**
+ * Null value for \ref dart_rwlock_t.
+ */
+#define DART_RWLOCK_NULL ((dart_rwlock_t)NULL)
+
+/**
+ * Collective operation to initialize the reader-writer lock \c lock.
+ *
+ * Writers are queued in the order of their arrival and wait for their
+ * predecessor's hand-over by polling a flag in their local memory.
+ * Readers waiting for a writer to release the lock poll their local
+ * memory as well. Pending writers take precedence over arriving readers.
+ *
+ * \param teamid Team this lock is used for.
+ * \param[out] lock The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_init(
+  dart_team_t     teamid,
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Collective operation to destroy a \c lock initialized using
+ * \ref dart_team_rwlock_init.
+ *
+ * \param lock   The \c lock to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_destroy(
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired for exclusive (write) access.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired for shared (read) access.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_shared(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock for exclusive (write) access and return
+ * immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock for shared (read) access and return
+ * immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_shared(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release the lock acquired through \ref dart_rwlock_acquire or
+ * \ref dart_rwlock_try_acquire.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Release the lock acquired through \ref dart_rwlock_acquire_shared or
+ * \ref dart_rwlock_try_acquire_shared.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release_shared(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
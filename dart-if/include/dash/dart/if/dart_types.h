@@ -676,11 +676,35 @@ typedef struct {
 dart_unit_locality_t;
 
 /**
+ * Runtime configuration of DART, modifications have to be applied before
+ * DART is initialized.
+ *
  * \ingroup DartTypes
  */
 typedef struct
 {
   int log_enabled;
+  /**
+   * Whether to start a thread driving the progress of communication in the
+   * background, overridden by the environment variable
+   * \c DART_PROGRESS_THREAD. Requires initialization with
+   * \ref dart_init_thread and support for \c DART_THREAD_MULTIPLE.
+   */
+  int progress_thread;
+  /**
+   * CPU the progress thread is pinned to, overridden by the environment
+   * variable \c DART_PROGRESS_CPU. If negative, the progress thread is
+   * pinned to a CPU available to the unit other than the unit's CPU.
+   * Progress threads of units on the same node sharing the same CPUs are
+   * pinned to different CPUs where possible.
+   */
+  int progress_cpu;
+  /**
+   * Interval in microseconds between two polls of the progress thread,
+   * overridden by the environment variable \c DART_PROGRESS_INTERVAL.
+   * If zero, the progress thread only yields between polls.
+   */
+  int progress_interval_us;
 }
 dart_config_t;
 
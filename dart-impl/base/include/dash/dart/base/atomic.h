@@ -204,6 +204,18 @@ __fetch_and_addptr(char **ptr, int64_t val) {
 
 
 
+#define DART_FETCH64(ptr) \
+          (*(volatile int64_t *)(ptr))
+#define DART_FETCH32(ptr) \
+          (*(volatile int32_t *)(ptr))
+#define DART_FETCH16(ptr) \
+          (*(volatile int16_t *)(ptr))
+#define DART_FETCH8(ptr)  \
+          (*(volatile int8_t  *)(ptr))
+#define DART_FETCHPTR(ptr) \
+          (*(void * volatile *)(ptr))
+
+
 #define DART_FETCH_AND_ADD64(ptr, val) \
           __fetch_and_add64((ptr), (val))
 #define DART_FETCH_AND_ADD32(ptr, val) \
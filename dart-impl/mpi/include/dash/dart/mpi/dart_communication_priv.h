@@ -12,6 +12,7 @@
 #include <dash/dart/base/macro.h>
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/mutex.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -77,6 +78,28 @@ dart_ret_t dart__mpi__op_fini();
 
 #define DART_MPI_TYPE_UNDEFINED (MPI_Datatype)MPI_UNDEFINED
 
+/**
+ * The number of committed MPI vector types cached per strided DART type.
+ */
+#define DART_MPI_STRIDED_CACHE_SIZE 8
+
+/**
+ * The maximum number of MPI vector types evicted from the cache of a
+ * strided DART type that are kept before the oldest of them is freed.
+ */
+#define DART_MPI_STRIDED_RETIRED_SIZE (16 * DART_MPI_STRIDED_CACHE_SIZE)
+
+/**
+ * A committed MPI vector type covering \c num_blocks blocks of a strided
+ * DART type.
+ */
+typedef struct dart_mpi_strided_cache_entry {
+  /// the number of blocks covered by \c mpi_type, 0 for unused entries
+  size_t               num_blocks;
+  /// the committed MPI vector type
+  MPI_Datatype         mpi_type;
+} dart_mpi_strided_cache_entry_t;
+
 typedef enum {
   DART_KIND_BASIC = 0,
   DART_KIND_STRIDED,
@@ -103,10 +126,26 @@ typedef struct dart_datatype_struct {
     } contiguous;
     /// used for DART_KIND_STRIDED
     /// NOTE: the underlying MPI strided type is created dynamically based on
-    ///       the number of blocks required.
+    ///       the number of blocks required and cached until the DART type
+    ///       is destroyed.
     struct {
       /// the stride between blocks of size \c num_elem
       int              stride;
+      /// the next cache entry to be replaced if the cache is full
+      int              cache_next;
+      /// committed MPI vector types for recently used numbers of blocks
+      dart_mpi_strided_cache_entry_t cache[DART_MPI_STRIDED_CACHE_SIZE];
+      /// MPI vector types evicted from \c cache, which may still be used
+      /// by other threads, the oldest is freed once the list is full
+      MPI_Datatype   * retired;
+      /// the number of types in \c retired
+      size_t           num_retired;
+      /// the capacity of \c retired
+      size_t           retired_capacity;
+      /// the oldest entry in \c retired once it is full
+      size_t           retired_next;
+      /// protects \c cache against concurrent access
+      dart_mutex_t     cache_mutex;
     } strided;
     /// used for DART_KIND_INDEXED
     struct {
@@ -118,6 +157,8 @@ typedef struct dart_datatype_struct {
       int            * offsets;
       /// the number of blocks
       int              num_blocks;
+      /// the extent in elements, i.e., the distance between repetitions
+      int              extent;
     } indexed;
   };
 } dart_datatype_struct_t;
@@ -131,6 +172,18 @@ dart__mpi__datatype_init() DART_INTERNAL;
 dart_ret_t
 dart__mpi__datatype_fini() DART_INTERNAL;
 
+/**
+ * Set up the pool from which handles of non-blocking operations are drawn.
+ */
+dart_ret_t
+dart__mpi__handle_pool_init() DART_INTERNAL;
+
+/**
+ * Release the memory of all handles, outstanding handles become invalid.
+ */
+dart_ret_t
+dart__mpi__handle_pool_fini() DART_INTERNAL;
+
 MPI_Datatype
 dart__mpi__datatype_create_max_datatype(MPI_Datatype mpi_type) DART_INTERNAL;
 
@@ -206,14 +259,20 @@ size_t dart__mpi__datatype_num_elem(dart_datatype_t dart_type) {
   return (dart__mpi__datatype_struct(dart_type)->num_elem);
 }
 
+/**
+ * Return a committed MPI vector type covering \c num_blocks blocks of the
+ * strided DART type \c dart_type.
+ *
+ * The MPI type is taken from the type's cache or created and inserted into
+ * it. It is owned by the DART type and must not be freed by the caller.
+ * It remains valid after its eviction from the cache until
+ * \ref DART_MPI_STRIDED_RETIRED_SIZE further types have been evicted.
+ */
 MPI_Datatype
-dart__mpi__create_strided_mpi(
+dart__mpi__strided_mpi_type(
   dart_datatype_t dart_type,
   size_t          num_blocks) DART_INTERNAL;
 
-void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type) DART_INTERNAL;
-
 DART_INLINE
 void
 dart__mpi__datatype_convert_mpi(
@@ -231,7 +290,7 @@ dart__mpi__datatype_convert_mpi(
       break;
     case DART_KIND_STRIDED:
       *mpi_num_elem = 1;
-      *mpi_type     = dart__mpi__create_strided_mpi(
+      *mpi_type     = dart__mpi__strided_mpi_type(
                                       dart_type, dart_num_elem / dts->num_elem);
       break;
     case DART_KIND_INDEXED:
@@ -246,6 +305,22 @@ dart__mpi__datatype_convert_mpi(
 
 char* dart__mpi__datatype_name(dart_datatype_t dart_type) DART_INTERNAL;
 
+/**
+ * Copy \c nelem elements from \c src laid out according to \c src_type
+ * to \c dst laid out according to \c dst_type by walking the blocks of
+ * both types. Both types have to share the same base type.
+ *
+ * Used to transfer strided and indexed data directly through shared memory
+ * windows instead of the MPI datatype engine.
+ */
+void
+dart__mpi__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem) DART_INTERNAL;
+
 /**
  * Helper macro that checks whether the given type is a basic type
  * and errors out in case of an error.
@@ -0,0 +1,70 @@
+#ifndef DART__MPI__DART_LOCALPOOL_H__
+#define DART__MPI__DART_LOCALPOOL_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <mpi.h>
+
+/**
+ * Memory pool serving \c dart_memalloc.
+ *
+ * The pool starts with the memory reserved for local allocations at
+ * initialization (segment \c DART_SEGMENT_LOCAL), which is accessible
+ * through shared memory windows on the node. If it is exhausted, further
+ * chunks are allocated and attached to a dynamic window on demand
+ * (segment \c DART_SEGMENT_LOCAL_EXT) without involving other units.
+ *
+ * Small allocations are served from per-size-class free lists with a
+ * per-thread cache in front of them. Larger allocations and the slabs
+ * backing the size classes are served by a buddy allocator per chunk.
+ */
+
+/**
+ * Initialize the pool with the initial memory region \c base of
+ * \c size bytes, which has to be a power of two.
+ * Collective on \c DART_TEAM_ALL, registers \c DART_SEGMENT_LOCAL_EXT
+ * in the segment data of \c team_data.
+ */
+dart_ret_t
+dart__mpi__localpool_init(
+  dart_team_data_t * team_data,
+  char             * base,
+  size_t             size) DART_INTERNAL;
+
+/**
+ * Release all memory attached to the pool. Collective on
+ * \c DART_TEAM_ALL.
+ */
+dart_ret_t
+dart__mpi__localpool_fini() DART_INTERNAL;
+
+/**
+ * Allocate \c nbytes from the pool. Sets the segment ID and offset of
+ * \c gptr.
+ */
+dart_ret_t
+dart__mpi__localpool_alloc(
+  size_t        nbytes,
+  dart_gptr_t * gptr) DART_INTERNAL;
+
+/**
+ * Return the memory referenced by \c gptr to the pool.
+ */
+dart_ret_t
+dart__mpi__localpool_free(
+  dart_gptr_t   gptr) DART_INTERNAL;
+
+/**
+ * Returns the window through which the local allocation referenced by
+ * \c gptr is accessed, or \c MPI_WIN_NULL if \c gptr does not refer to
+ * a local allocation.
+ */
+MPI_Win
+dart__mpi__localpool_win(
+  dart_gptr_t   gptr) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_LOCALPOOL_H__ */
@@ -17,7 +17,6 @@
 // forward declaration
 struct dart_buddy;
 extern char* dart_mempool_localalloc DART_INTERNAL;
-extern struct dart_buddy* dart_localpool DART_INTERNAL;
 
 /**
  * Create a new buddy allocator instance.
@@ -0,0 +1,33 @@
+/**
+ * \file dash/dart/mpi/dart_progress.h
+ *
+ * Asynchronous progress thread of the DART-MPI library.
+ */
+#ifndef DART__MPI__DART_PROGRESS_H__
+#define DART__MPI__DART_PROGRESS_H__
+
+#include <stdbool.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * Start the progress thread if enabled in the DART configuration.
+ * Must be called after the locality information has been initialized.
+ *
+ * \param thread_multiple  Whether MPI has been initialized with support
+ *                         for \c MPI_THREAD_MULTIPLE.
+ */
+dart_ret_t dart__mpi__progress_init(bool thread_multiple) DART_INTERNAL;
+
+/**
+ * Stop the progress thread, if running.
+ */
+dart_ret_t dart__mpi__progress_fini() DART_INTERNAL;
+
+/**
+ * Whether the progress thread is running.
+ */
+bool dart__mpi__progress_active() DART_INTERNAL;
+
+#endif /* DART__MPI__DART_PROGRESS_H__ */
@@ -15,7 +15,23 @@
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/**
+ * Segments are looked up in a table directly indexed by the segment ID.
+ * The table is split into blocks of \c DART_SEGMENT_BLOCK_SIZE entries that
+ * are allocated on first use, the directory of blocks covers all segment
+ * IDs of one sign.
+ */
+#define DART_SEGMENT_BLOCK_BITS  7
+#define DART_SEGMENT_BLOCK_SIZE  (1 << DART_SEGMENT_BLOCK_BITS)
+#define DART_SEGMENT_NUM_BLOCKS  ((INT16_MAX >> DART_SEGMENT_BLOCK_BITS) + 1)
+
+/**
+ * Segment ID of local allocations served from memory attached to the
+ * local allocation pool on demand, see \c dart_localpool.h.
+ * Offsets in this segment are absolute addresses at the owning unit.
+ * The ID is never handed out for registered segments.
+ */
+#define DART_SEGMENT_LOCAL_EXT ((int16_t)INT16_MIN)
 
 typedef struct
 {
@@ -31,13 +47,16 @@ typedef struct
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct dart_segment_elem dart_segment_elem_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
-  dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
+  /* segments with ID >= 0, indexed by segid */
+  dart_segment_elem_t ** mem_blocks[DART_SEGMENT_NUM_BLOCKS];
+  /* segments with ID < 0, indexed by -(segid + 1) */
+  dart_segment_elem_t ** reg_blocks[DART_SEGMENT_NUM_BLOCKS];
+  dart_team_t            team_id;
+  dart_segment_elem_t  * mem_freelist;
+  dart_segment_elem_t  * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
@@ -54,13 +73,14 @@ typedef struct {
 
 typedef enum {
   DART_SEGMENT_LOCAL_ALLOC,
+  DART_SEGMENT_LOCAL_EXT_ALLOC,
   DART_SEGMENT_ALLOC,
   DART_SEGMENT_REGISTER
 } dart_segment_type;
 
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment data table.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -178,7 +198,7 @@ dart_ret_t dart_segment_free(
 
 
 /**
- * Clear the segment data hash table.
+ * Clear the segment data table.
  */
 dart_ret_t dart_segment_fini(dart_segmentdata_t *segdata) DART_INTERNAL;
 
@@ -192,6 +192,18 @@ typedef struct dart_team_data {
 
   dart_team_t teamid;
 
+  /**
+   * @brief Global unit ID of every unit in the team, indexed by the
+   * team-relative unit ID.
+   */
+  dart_global_unit_t *unit_l2g;
+
+  /**
+   * @brief Team-relative unit ID of every unit in \c DART_TEAM_ALL,
+   * \c DART_UNDEFINED_UNIT_ID for units not in the team.
+   */
+  dart_team_unit_t *unit_g2l;
+
   struct dart_lock_struct *allocated_locks;
 
 } dart_team_data_t;
@@ -233,6 +245,19 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid) DART_INTERNAL;
 dart_team_data_t *
 dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
 
+/**
+ * Set up the translation tables between team-relative and global unit IDs
+ * of \c team_data, requires \c comm and \c size to be set.
+ */
+dart_ret_t dart_adapt_team_unit_tables_init(
+  dart_team_data_t *team_data) DART_INTERNAL;
+
+/**
+ * Release the unit ID translation tables of \c team_data.
+ */
+void dart_adapt_team_unit_tables_fini(
+  dart_team_data_t *team_data) DART_INTERNAL;
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
  * Allocate shared memory communicator for the given \c team_data.
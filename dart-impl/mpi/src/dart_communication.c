@@ -19,6 +19,7 @@
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_progress.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
@@ -30,6 +31,12 @@
 #include <math.h>
 #include <alloca.h>
 
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L \
+    && !defined(__STDC_NO_ATOMICS__)
+#define DART_MPI_HAVE_STDATOMIC
+#include <stdatomic.h>
+#endif
+
 
 #define CHECK_UNITID_RANGE(_unitid, _team_data)                             \
   do {                                                                      \
@@ -97,8 +104,266 @@ struct dart_handle_struct
   dart_unit_t dest;
   uint8_t     num_reqs;
   bool        needs_flush;
+  void      * tmpbuf;    // temporaries to release on completion, e.g.,
+                         // count arrays of non-blocking v-collectives
+  struct dart_handle_struct * next;  // next free handle in the pool
+};
+
+/** Group of requests of non-blocking operations completed together. */
+struct dart_handle_group_struct
+{
+  MPI_Request * reqs;
+  size_t        num_reqs;
+  size_t        capacity;
+  // windows of operations requiring a flush for remote completion
+  MPI_Win     * flush_wins;
+  int           num_flush_wins;
+  int           flush_capacity;
 };
 
+/*
+ * Handles are recycled through per-thread free lists instead of
+ * allocating one for every non-blocking operation. Free lists are
+ * refilled with blocks of DART_HANDLE_POOL_BLOCK handles, which are only
+ * released in dart_exit. The per-thread state also holds the scratch
+ * space for collecting the requests of handles in dart_waitall & co.
+ */
+#define DART_HANDLE_POOL_BLOCK 64
+
+typedef struct dart_handle_block
+{
+  struct dart_handle_block  * next;
+  struct dart_handle_struct   handles[DART_HANDLE_POOL_BLOCK];
+} dart_handle_block_t;
+
+/*
+ * Values of deferred accumulates are copied into per-thread slots of
+ * DART_ACC_DEFER_SLOT bytes, see dart_accumulate_deferred. The slots are
+ * only recycled after all of them have been used and the operations on
+ * the segments they targeted have been completed locally.
+ */
+#define DART_ACC_DEFER_CAPACITY 1024
+#define DART_ACC_DEFER_SLOT     16
+#define DART_ACC_DEFER_SEGS     8
+
+typedef struct dart_acc_defer_seg
+{
+  dart_team_t  teamid;
+  int16_t      segid;
+} dart_acc_defer_seg_t;
+
+typedef struct dart_handle_cache
+{
+  dart_handle_t          free_handles;
+  MPI_Request          * reqs;
+  size_t                 reqs_capacity;
+  char                 * acc_values;
+  size_t                 num_acc_values;
+  dart_acc_defer_seg_t   acc_segs[DART_ACC_DEFER_SEGS];
+  int                    num_acc_segs;
+} dart_handle_cache_t;
+
+static struct {
+  dart_mutex_t          mutex;
+  // handles left behind by terminated threads
+  dart_handle_t         free_handles;
+  dart_handle_block_t * blocks;
+#ifdef DART_HAVE_PTHREADS
+  pthread_key_t         cache_key;
+#endif
+} handle_pool;
+
+#ifndef DART_HAVE_PTHREADS
+static dart_handle_cache_t handle_single_cache;
+#endif
+
+static void dart__mpi__acc_defer_complete(dart_handle_cache_t *cache);
+
+#ifdef DART_HAVE_PTHREADS
+static void dart__mpi__handle_cache_destroy(void *ptr)
+{
+  dart_handle_cache_t *cache = ptr;
+  dart__mpi__acc_defer_complete(cache);
+  free(cache->acc_values);
+  if (cache->free_handles != NULL) {
+    dart_handle_t last = cache->free_handles;
+    while (last->next != NULL) {
+      last = last->next;
+    }
+    dart__base__mutex_lock(&handle_pool.mutex);
+    last->next = handle_pool.free_handles;
+    handle_pool.free_handles = cache->free_handles;
+    dart__base__mutex_unlock(&handle_pool.mutex);
+  }
+  free(cache->reqs);
+  free(cache);
+}
+#endif
+
+static inline
+dart_handle_cache_t * dart__mpi__handle_cache()
+{
+#ifdef DART_HAVE_PTHREADS
+  dart_handle_cache_t *cache = pthread_getspecific(handle_pool.cache_key);
+  if (dart__unlikely(cache == NULL)) {
+    cache = calloc(1, sizeof(dart_handle_cache_t));
+    pthread_setspecific(handle_pool.cache_key, cache);
+  }
+  return cache;
+#else
+  return &handle_single_cache;
+#endif
+}
+
+dart_ret_t dart__mpi__handle_pool_init()
+{
+  memset(&handle_pool, 0, sizeof(handle_pool));
+  dart__base__mutex_init(&handle_pool.mutex);
+#ifdef DART_HAVE_PTHREADS
+  if (pthread_key_create(
+        &handle_pool.cache_key, &dart__mpi__handle_cache_destroy) != 0) {
+    DART_LOG_ERROR("Failed to create the handle pool key");
+    return DART_ERR_OTHER;
+  }
+#else
+  memset(&handle_single_cache, 0, sizeof(handle_single_cache));
+#endif
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__handle_pool_fini()
+{
+#ifdef DART_HAVE_PTHREADS
+  dart_handle_cache_t *cache = pthread_getspecific(handle_pool.cache_key);
+  pthread_key_delete(handle_pool.cache_key);
+  if (cache != NULL) {
+    free(cache->reqs);
+    free(cache->acc_values);
+    free(cache);
+  }
+#else
+  free(handle_single_cache.reqs);
+  free(handle_single_cache.acc_values);
+  memset(&handle_single_cache, 0, sizeof(handle_single_cache));
+#endif
+  dart_handle_block_t *block = handle_pool.blocks;
+  while (block != NULL) {
+    dart_handle_block_t *next = block->next;
+    free(block);
+    block = next;
+  }
+  handle_pool.blocks       = NULL;
+  handle_pool.free_handles = NULL;
+  dart__base__mutex_destroy(&handle_pool.mutex);
+  return DART_OK;
+}
+
+/**
+ * Refill the free list of \c cache from the handles of terminated threads
+ * or a new block of handles.
+ */
+static
+void dart__mpi__handle_cache_refill(dart_handle_cache_t *cache)
+{
+  dart__base__mutex_lock(&handle_pool.mutex);
+  if (handle_pool.free_handles != NULL) {
+    cache->free_handles      = handle_pool.free_handles;
+    handle_pool.free_handles = NULL;
+  } else {
+    dart_handle_block_t *block = malloc(sizeof(dart_handle_block_t));
+    if (block != NULL) {
+      block->next        = handle_pool.blocks;
+      handle_pool.blocks = block;
+      for (int i = 0; i < DART_HANDLE_POOL_BLOCK - 1; ++i) {
+        block->handles[i].next = &block->handles[i + 1];
+      }
+      block->handles[DART_HANDLE_POOL_BLOCK - 1].next = NULL;
+      cache->free_handles = &block->handles[0];
+    }
+  }
+  dart__base__mutex_unlock(&handle_pool.mutex);
+}
+
+/**
+ * Take a handle from the pool, all fields are reset.
+ */
+static inline
+dart_handle_t dart__mpi__handle_alloc()
+{
+  dart_handle_cache_t *cache = dart__mpi__handle_cache();
+  if (dart__unlikely(cache->free_handles == NULL)) {
+    dart__mpi__handle_cache_refill(cache);
+    if (cache->free_handles == NULL) {
+      DART_LOG_ERROR("Failed to allocate handle");
+      return DART_HANDLE_NULL;
+    }
+  }
+  dart_handle_t handle = cache->free_handles;
+  cache->free_handles  = handle->next;
+  memset(handle, 0, sizeof(*handle));
+  return handle;
+}
+
+/**
+ * Release a handle and the temporaries attached to it.
+ */
+static inline
+void dart__mpi__handle_release(dart_handle_t handle)
+{
+  dart_handle_cache_t *cache = dart__mpi__handle_cache();
+  free(handle->tmpbuf);
+  handle->tmpbuf      = NULL;
+  handle->next        = cache->free_handles;
+  cache->free_handles = handle;
+}
+
+/**
+ * Scratch space for at least \c n requests, valid until the next call
+ * in the same thread.
+ */
+static inline
+MPI_Request * dart__mpi__handle_scratch(size_t n)
+{
+  dart_handle_cache_t *cache = dart__mpi__handle_cache();
+  if (dart__unlikely(cache->reqs_capacity < n)) {
+    size_t capacity = (cache->reqs_capacity > 0) ? cache->reqs_capacity : 64;
+    while (capacity < n) {
+      capacity *= 2;
+    }
+    MPI_Request *reqs = realloc(cache->reqs, capacity * sizeof(MPI_Request));
+    if (reqs == NULL) {
+      return NULL;
+    }
+    cache->reqs          = reqs;
+    cache->reqs_capacity = capacity;
+  }
+  return cache->reqs;
+}
+
+/**
+ * Complete all deferred accumulates issued by the calling thread locally
+ * so that their value slots can be reused.
+ */
+static void dart__mpi__acc_defer_complete(dart_handle_cache_t *cache)
+{
+  for (int i = 0; i < cache->num_acc_segs; ++i) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(
+                                    cache->acc_segs[i].teamid);
+    if (team_data == NULL) {
+      // the team and its windows are gone
+      continue;
+    }
+    dart_segment_info_t *seginfo = dart_segment_get_info(
+                                     &(team_data->segdata),
+                                     cache->acc_segs[i].segid);
+    if (seginfo != NULL) {
+      MPI_Win_flush_local_all(seginfo->win);
+    }
+  }
+  cache->num_acc_values = 0;
+  cache->num_acc_segs   = 0;
+}
+
 /**
  * Help to check for return of MPI call.
  * Since DART currently does not define an MPI error handler the abort will not
@@ -157,6 +422,29 @@ static dart_ret_t put_shared_mem(
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Returns a pointer to the memory at \c offset in the segment \c seginfo
+ * of unit \c unitid if it is directly accessible, i.e., if it is the calling
+ * unit or a unit reachable through a shared memory window, or NULL otherwise.
+ */
+static inline char * local_target_ptr(
+    const dart_team_data_t    * team_data,
+    const dart_segment_info_t * seginfo,
+    uint64_t                    offset,
+    dart_team_unit_t            unitid)
+{
+  if (team_data->unitid == unitid.id) {
+    return seginfo->selfbaseptr + offset;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 && team_data->sharedmem_tab[unitid.id].id >= 0) {
+    dart_team_unit_t luid = team_data->sharedmem_tab[unitid.id];
+    return seginfo->baseptr[luid.id] + offset;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return NULL;
+}
+
 /**
  * Internal implementations of put/get with and without handles for
  * basic data types and complex data types.
@@ -282,6 +570,7 @@ dart__mpi__get_basic(
 static inline
   dart_ret_t
 dart__mpi__get_complex(
+    const dart_team_data_t    * team_data,
     dart_team_unit_t            team_unit_id,
     const dart_segment_info_t * seginfo,
     void                      * dest,
@@ -296,6 +585,15 @@ dart__mpi__get_complex(
 
   CHECK_TYPE_CONSTRAINTS(src_type, dst_type, nelem);
 
+  // pack/unpack directly if the target memory is accessible
+  const char * src_ptr = local_target_ptr(
+                              team_data, seginfo, offset, team_unit_id);
+  if (src_ptr != NULL) {
+    DART_LOG_DEBUG("dart_get: local copy of %zu elements", nelem);
+    dart__mpi__datatype_copy(dest, dst_type, src_ptr, src_type, nelem);
+    return DART_OK;
+  }
+
   MPI_Win win     = seginfo->win;
   char * dest_ptr = (char*) dest;
   offset         += dart_segment_disp(seginfo, team_unit_id);
@@ -324,13 +622,6 @@ dart__mpi__get_complex(
         win,
         reqs, num_reqs),
       "MPI_Rget");
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
-  }
   return DART_OK;
 }
 
@@ -421,6 +712,7 @@ dart__mpi__put_basic(
 static inline
   dart_ret_t
 dart__mpi__put_complex(
+    const dart_team_data_t    * team_data,
     dart_team_unit_t            team_unit_id,
     const dart_segment_info_t * seginfo,
     const void                * src,
@@ -432,12 +724,22 @@ dart__mpi__put_complex(
     uint8_t                   * num_reqs,
     bool                      * flush_required_ptr)
 {
-  if (flush_required_ptr) *flush_required_ptr = true;
   if (num_reqs) *num_reqs = 0;
 
-  // slow path for derived types
   CHECK_TYPE_CONSTRAINTS(src_type, dst_type, nelem);
 
+  // pack/unpack directly if the target memory is accessible
+  char * dst_ptr = local_target_ptr(team_data, seginfo, offset, team_unit_id);
+  if (dst_ptr != NULL) {
+    if (flush_required_ptr) *flush_required_ptr = false;
+    DART_LOG_DEBUG("dart_put: local copy of %zu elements", nelem);
+    dart__mpi__datatype_copy(dst_ptr, dst_type, src, src_type, nelem);
+    return DART_OK;
+  }
+
+  // slow path for derived types
+  if (flush_required_ptr) *flush_required_ptr = true;
+
   MPI_Win win            = seginfo->win;
   const char * src_ptr   = (const char*) src;
   offset                += dart_segment_disp(seginfo, team_unit_id);
@@ -470,13 +772,6 @@ dart__mpi__put_complex(
         reqs, num_reqs),
       "MPI_Put");
 
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
-  }
   return DART_OK;
 }
 
@@ -525,7 +820,7 @@ dart_ret_t dart_get(
         offset, nelem, src_type, NULL, NULL);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
         offset, nelem, src_type, dst_type, NULL, NULL);
   }
 
@@ -574,7 +869,7 @@ dart_ret_t dart_put(
         NULL, NULL, NULL);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
         offset, nelem, src_type, dst_type,
         NULL, NULL, NULL);
   }
@@ -582,6 +877,175 @@ dart_ret_t dart_put(
   return ret;
 }
 
+/* -- Node-local atomic operations -- */
+
+/**
+ * Returns the address of the target of an atomic operation if it may be
+ * accessed through processor atomics, see \ref DART_GPTR_FLAG_SHMEM_ATOMICS,
+ * or NULL otherwise.
+ */
+static inline char * shmem_atomic_target(
+    const dart_team_data_t    * team_data,
+    const dart_segment_info_t * seginfo,
+    uint64_t                    offset,
+    dart_team_unit_t            unitid)
+{
+  if (!(seginfo->flags & DART_GPTR_FLAG_SHMEM_ATOMICS)) {
+    return NULL;
+  }
+  return local_target_ptr(team_data, seginfo, offset, unitid);
+}
+
+#if defined(DART_MPI_HAVE_STDATOMIC)
+
+#define DART_SHMEM_ATOMIC_TYPES(_macro)           \
+  _macro(DART_TYPE_BYTE,      char)               \
+  _macro(DART_TYPE_SHORT,     short)              \
+  _macro(DART_TYPE_INT,       int)                \
+  _macro(DART_TYPE_UINT,      unsigned int)       \
+  _macro(DART_TYPE_LONG,      long)               \
+  _macro(DART_TYPE_ULONG,     unsigned long)      \
+  _macro(DART_TYPE_LONGLONG,  long long)          \
+  _macro(DART_TYPE_ULONGLONG, unsigned long long)
+
+#define DART_SHMEM_FETCH_OP_CASE(_dtype, _type)                               \
+  case _dtype:                                                                \
+  {                                                                           \
+    _Atomic _type * ptr = (_Atomic _type *)target;                            \
+    _type val = (op == DART_OP_NO_OP) ? 0 : *(const _type *)value;            \
+    _type prev;                                                               \
+    if (!atomic_is_lock_free(ptr)) {                                          \
+      return false;                                                           \
+    }                                                                         \
+    switch (op) {                                                             \
+      case DART_OP_SUM:     prev = atomic_fetch_add(ptr, val); break;         \
+      case DART_OP_BAND:    prev = atomic_fetch_and(ptr, val); break;         \
+      case DART_OP_BOR:     prev = atomic_fetch_or(ptr, val);  break;         \
+      case DART_OP_BXOR:    prev = atomic_fetch_xor(ptr, val); break;         \
+      case DART_OP_REPLACE: prev = atomic_exchange(ptr, val);  break;         \
+      case DART_OP_NO_OP:   prev = atomic_load(ptr);           break;         \
+      case DART_OP_MIN:                                                       \
+        prev = atomic_load(ptr);                                              \
+        while (val < prev &&                                                  \
+               !atomic_compare_exchange_weak(ptr, &prev, val)) { }            \
+        break;                                                                \
+      case DART_OP_MAX:                                                       \
+        prev = atomic_load(ptr);                                              \
+        while (val > prev &&                                                  \
+               !atomic_compare_exchange_weak(ptr, &prev, val)) { }            \
+        break;                                                                \
+      default:                                                                \
+        return false;                                                         \
+    }                                                                         \
+    if (result != NULL) {                                                     \
+      *(_type *)result = prev;                                                \
+    }                                                                         \
+    return true;                                                              \
+  }
+
+#define DART_SHMEM_CAS_CASE(_dtype, _type)                                    \
+  case _dtype:                                                                \
+  {                                                                           \
+    _Atomic _type * ptr = (_Atomic _type *)target;                            \
+    _type expected = *(const _type *)compare;                                 \
+    if (!atomic_is_lock_free(ptr)) {                                          \
+      return false;                                                           \
+    }                                                                         \
+    atomic_compare_exchange_strong(ptr, &expected, *(const _type *)value);    \
+    *(_type *)result = expected;                                              \
+    return true;                                                              \
+  }
+
+/**
+ * Applies \c op with \c value to \c target through processor atomics and
+ * stores the previous value in \c result unless it is NULL.
+ * Returns false without modifying \c target if the combination of \c dtype
+ * and \c op is not supported.
+ */
+static bool shmem_fetch_op(
+    void             * target,
+    const void       * value,
+    void             * result,
+    dart_datatype_t    dtype,
+    dart_operation_t   op)
+{
+  switch (dtype) {
+    DART_SHMEM_ATOMIC_TYPES(DART_SHMEM_FETCH_OP_CASE)
+    default:
+      return false;
+  }
+}
+
+/**
+ * Compare-and-swap on \c target through processor atomics.
+ * Returns false without modifying \c target if \c dtype is not supported.
+ */
+static bool shmem_compare_and_swap(
+    void             * target,
+    const void       * value,
+    const void       * compare,
+    void             * result,
+    dart_datatype_t    dtype)
+{
+  switch (dtype) {
+    DART_SHMEM_ATOMIC_TYPES(DART_SHMEM_CAS_CASE)
+    default:
+      return false;
+  }
+}
+
+#undef DART_SHMEM_CAS_CASE
+#undef DART_SHMEM_FETCH_OP_CASE
+#undef DART_SHMEM_ATOMIC_TYPES
+
+#else // !defined(DART_MPI_HAVE_STDATOMIC)
+
+static inline bool shmem_fetch_op(
+    void             * target,
+    const void       * value,
+    void             * result,
+    dart_datatype_t    dtype,
+    dart_operation_t   op)
+{
+  return false;
+}
+
+static inline bool shmem_compare_and_swap(
+    void             * target,
+    const void       * value,
+    const void       * compare,
+    void             * result,
+    dart_datatype_t    dtype)
+{
+  return false;
+}
+
+#endif // defined(DART_MPI_HAVE_STDATOMIC)
+
+/**
+ * Element-wise atomic accumulate of \c nelem values on \c target, returns
+ * false without modifying \c target if not supported.
+ */
+static bool shmem_accumulate(
+    char             * target,
+    const char       * values,
+    size_t             nelem,
+    dart_datatype_t    dtype,
+    dart_operation_t   op)
+{
+  size_t elem_size = dart__mpi__datatype_sizeof(dtype);
+  for (size_t i = 0; i < nelem; ++i) {
+    // support only depends on the type and operation, checked on the
+    // first element
+    if (!shmem_fetch_op(target, values, NULL, dtype, op)) {
+      return false;
+    }
+    target += elem_size;
+    values += elem_size;
+  }
+  return true;
+}
+
 dart_ret_t dart_accumulate(
     dart_gptr_t      gptr,
     const void     * values,
@@ -621,6 +1085,14 @@ dart_ret_t dart_accumulate(
     return DART_ERR_INVAL;
   }
 
+  char * target = shmem_atomic_target(
+                    team_data, seginfo, offset, team_unit_id);
+  if (target != NULL &&
+      shmem_accumulate(target, values, nelem, dtype, op)) {
+    DART_LOG_DEBUG("dart_accumulate > finished on shared memory");
+    return DART_OK;
+  }
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -712,6 +1184,14 @@ dart_ret_t dart_accumulate_blocking_local(
     return DART_ERR_INVAL;
   }
 
+  char * target = shmem_atomic_target(
+                    team_data, seginfo, offset, team_unit_id);
+  if (target != NULL &&
+      shmem_accumulate(target, values, nelem, dtype, op)) {
+    DART_LOG_DEBUG("dart_accumulate > finished on shared memory");
+    return DART_OK;
+  }
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -770,6 +1250,105 @@ dart_ret_t dart_accumulate_blocking_local(
 }
 
 
+dart_ret_t dart_accumulate_deferred(
+    dart_gptr_t      gptr,
+    const void     * value,
+    dart_datatype_t  dtype,
+    dart_operation_t op)
+{
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t    offset = gptr.addr_or_offs.offset;
+  int16_t     seg_id = gptr.segid;
+  dart_team_t teamid = gptr.teamid;
+
+  if (dart__unlikely(op > DART_OP_LAST)) {
+    DART_LOG_ERROR("Custom reduction operators not allowed in "
+                   "dart_accumulate_deferred!");
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_IS_BASICTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  size_t       nbytes    = dart__mpi__datatype_sizeof(dtype);
+  DART_ASSERT(nbytes <= DART_ACC_DEFER_SLOT);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_deferred ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+      &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_deferred ! "
+        "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  char * target = shmem_atomic_target(
+                    team_data, seginfo, offset, team_unit_id);
+  if (target != NULL && shmem_fetch_op(target, value, NULL, dtype, op)) {
+    DART_LOG_DEBUG("dart_accumulate_deferred > finished on shared memory");
+    return DART_OK;
+  }
+
+  dart_handle_cache_t *cache = dart__mpi__handle_cache();
+  if (dart__unlikely(cache->acc_values == NULL)) {
+    cache->acc_values = malloc(DART_ACC_DEFER_CAPACITY * DART_ACC_DEFER_SLOT);
+    if (cache->acc_values == NULL) {
+      DART_LOG_ERROR("dart_accumulate_deferred ! Failed to allocate slots");
+      return DART_ERR_OTHER;
+    }
+  }
+
+  int seg_idx;
+  for (seg_idx = 0; seg_idx < cache->num_acc_segs; ++seg_idx) {
+    if (cache->acc_segs[seg_idx].teamid == teamid &&
+        cache->acc_segs[seg_idx].segid  == seg_id) {
+      break;
+    }
+  }
+  if (cache->num_acc_values == DART_ACC_DEFER_CAPACITY ||
+      seg_idx == DART_ACC_DEFER_SEGS) {
+    DART_LOG_TRACE("dart_accumulate_deferred: recycling value slots");
+    dart__mpi__acc_defer_complete(cache);
+    seg_idx = 0;
+  }
+  if (seg_idx == cache->num_acc_segs) {
+    cache->acc_segs[seg_idx].teamid = teamid;
+    cache->acc_segs[seg_idx].segid  = seg_id;
+    cache->num_acc_segs++;
+  }
+
+  char * slot = cache->acc_values
+                + (cache->num_acc_values++ * DART_ACC_DEFER_SLOT);
+  memcpy(slot, value, nbytes);
+
+  offset += dart_segment_disp(seginfo, team_unit_id);
+  DART_LOG_DEBUG("dart_accumulate_deferred() dtype:%ld op:%ld unit:%d",
+                 dtype, op, team_unit_id.id);
+  CHECK_MPI_RET(
+      MPI_Accumulate(
+        slot,
+        1,
+        mpi_dtype,
+        team_unit_id.id,
+        offset,
+        1,
+        mpi_dtype,
+        mpi_op,
+        seginfo->win),
+      "MPI_Accumulate");
+
+  DART_LOG_DEBUG("dart_accumulate_deferred > finished");
+  return DART_OK;
+}
+
 dart_ret_t dart_fetch_and_op(
     dart_gptr_t      gptr,
     const void *     value,
@@ -814,6 +1393,13 @@ dart_ret_t dart_fetch_and_op(
       dtype, op, team_unit_id.id,
       gptr.addr_or_offs.offset, seg_id);
 
+  char * target = shmem_atomic_target(
+                    team_data, seginfo, offset, team_unit_id);
+  if (target != NULL && shmem_fetch_op(target, value, result, dtype, op)) {
+    DART_LOG_DEBUG("dart_fetch_and_op > finished on shared memory");
+    return DART_OK;
+  }
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -872,6 +1458,14 @@ dart_ret_t dart_compare_and_swap(
     return DART_ERR_INVAL;
   }
 
+  char * target = shmem_atomic_target(
+                    team_data, seginfo, offset, team_unit_id);
+  if (target != NULL &&
+      shmem_compare_and_swap(target, value, compare, result, dtype)) {
+    DART_LOG_DEBUG("dart_compare_and_swap > finished on shared memory");
+    return DART_OK;
+  }
+
   MPI_Win win  = seginfo->win;
   offset      += dart_segment_disp(seginfo, team_unit_id);
 
@@ -889,42 +1483,335 @@ dart_ret_t dart_compare_and_swap(
   return DART_OK;
 }
 
-/* -- Non-blocking dart one-sided operations -- */
+/* -- Aggregated dart atomic operations -- */
+
+#define DART_AGGREGATOR_DEFAULT_THRESHOLD 1024
+
+typedef struct {
+  uint64_t offset;
+  int16_t  segid;
+  /// position of the update in the buffer, preserves the order of updates
+  /// of the same element
+  uint32_t idx;
+} agg_entry_t;
+
+typedef struct {
+  agg_entry_t * entries;
+  /// operands of the updates, in the order of entries
+  char        * values;
+  size_t        size;
+} agg_buffer_t;
+
+struct dart_aggregator_struct {
+  dart_team_t      teamid;
+  dart_datatype_t  dtype;
+  dart_operation_t op;
+  MPI_Datatype     mpi_dtype;
+  MPI_Op           mpi_op;
+  size_t           dtype_size;
+  size_t           threshold;
+  int              nunits;
+  /// one buffer per unit in the team
+  agg_buffer_t   * buffers;
+  /// scratch space to pack a batch of updates
+  char           * packed;
+  MPI_Aint       * disps;
+  /// windows with updates not yet completed at the target
+  MPI_Win        * wins;
+  int              num_wins;
+};
 
-dart_ret_t dart_get_handle(
-    void          * dest,
-    dart_gptr_t     gptr,
-    size_t          nelem,
-    dart_datatype_t src_type,
-    dart_datatype_t dst_type,
-    dart_handle_t * handleptr)
+static int agg_entry_cmp(const void *lhs_ptr, const void *rhs_ptr)
 {
-  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  uint64_t         offset = gptr.addr_or_offs.offset;
-  int16_t          seg_id = gptr.segid;
-  dart_team_t      teamid = gptr.teamid;
+  const agg_entry_t *lhs = (const agg_entry_t *)lhs_ptr;
+  const agg_entry_t *rhs = (const agg_entry_t *)rhs_ptr;
+  if (lhs->segid  != rhs->segid)  return (lhs->segid  < rhs->segid)  ? -1 : 1;
+  if (lhs->offset != rhs->offset) return (lhs->offset < rhs->offset) ? -1 : 1;
+  if (lhs->idx    != rhs->idx)    return (lhs->idx    < rhs->idx)    ? -1 : 1;
+  return 0;
+}
 
-  *handleptr = DART_HANDLE_NULL;
+/**
+ * Ship the updates buffered for unit \c unit, one accumulate operation
+ * per segment. Updates of the same element are combined in order before.
+ */
+static dart_ret_t dart__mpi__aggregator_ship(
+  dart_aggregator_t agg,
+  dart_team_unit_t  unit)
+{
+  agg_buffer_t *buf = &agg->buffers[unit.id];
+  if (buf->size == 0) {
+    return DART_OK;
+  }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(agg->teamid);
   if (dart__unlikely(team_data == NULL)) {
-    DART_LOG_ERROR("dart_get_handle ! failed: Unknown team %i!", teamid);
+    DART_LOG_ERROR("dart_aggregator ! failed: Unknown team %i!", agg->teamid);
+    buf->size = 0;
     return DART_ERR_INVAL;
   }
 
-  CHECK_UNITID_RANGE(team_unit_id, team_data);
+  qsort(buf->entries, buf->size, sizeof(agg_entry_t), &agg_entry_cmp);
+
+  size_t dsize = agg->dtype_size;
+  for (size_t begin = 0, end; begin < buf->size; begin = end) {
+    int16_t segid = buf->entries[begin].segid;
+    for (end = begin + 1;
+         end < buf->size && buf->entries[end].segid == segid;
+         ++end) { }
+
+    dart_segment_info_t *seginfo = dart_segment_get_info(
+                                      &(team_data->segdata), segid);
+    if (dart__unlikely(seginfo == NULL)) {
+      DART_LOG_ERROR("dart_aggregator ! Unknown segment %i on team %i",
+                     segid, agg->teamid);
+      buf->size = 0;
+      return DART_ERR_INVAL;
+    }
 
-  dart_segment_info_t *seginfo = dart_segment_get_info(
-      &(team_data->segdata), seg_id);
-  if (dart__unlikely(seginfo == NULL)) {
-    DART_LOG_ERROR("dart_get_handle ! "
-        "Unknown segment %i on team %i", seg_id, teamid);
-    return DART_ERR_INVAL;
-  }
+    int num = 0;
+    for (size_t i = begin; i < end; ++i) {
+      const agg_entry_t *entry = &buf->entries[i];
+      const char        *value = buf->values + entry->idx * dsize;
+      if (num > 0 && entry->offset == buf->entries[i-1].offset) {
+        char *combined = agg->packed + (num - 1) * dsize;
+        if (agg->op == DART_OP_REPLACE) {
+          memcpy(combined, value, dsize);
+        } else {
+          CHECK_MPI_RET(
+            MPI_Reduce_local(value, combined, 1, agg->mpi_dtype, agg->mpi_op),
+            "MPI_Reduce_local");
+        }
+        continue;
+      }
+      agg->disps[num] = entry->offset;
+      memcpy(agg->packed + num * dsize, value, dsize);
+      ++num;
+    }
 
-  MPI_Win win  = seginfo->win;
+    // target displacements relative to the first element, dynamic windows
+    // look up the attached memory region by the target displacement
+    MPI_Aint tgt_base = agg->disps[0];
+    for (int i = 0; i < num; ++i) {
+      agg->disps[i] -= tgt_base;
+    }
+    tgt_base += dart_segment_disp(seginfo, unit);
+
+    MPI_Datatype tgt_type;
+    CHECK_MPI_RET(
+      MPI_Type_create_hindexed_block(
+        num, 1, agg->disps, agg->mpi_dtype, &tgt_type),
+      "MPI_Type_create_hindexed_block");
+    MPI_Type_commit(&tgt_type);
+
+    DART_LOG_TRACE("dart_aggregator: %zu updates of %d elements to unit %d",
+                   end - begin, num, unit.id);
+    CHECK_MPI_RET(
+      MPI_Accumulate(
+        agg->packed, num, agg->mpi_dtype,
+        unit.id, tgt_base, 1, tgt_type,
+        agg->mpi_op, seginfo->win),
+      "MPI_Accumulate");
+    MPI_Type_free(&tgt_type);
+    // the scratch buffer is reused for the next batch
+    CHECK_MPI_RET(
+      MPI_Win_flush_local(unit.id, seginfo->win), "MPI_Win_flush_local");
+
+    int w;
+    for (w = 0; w < agg->num_wins && agg->wins[w] != seginfo->win; ++w) { }
+    if (w == agg->num_wins) {
+      agg->wins = realloc(agg->wins, (agg->num_wins + 1) * sizeof(MPI_Win));
+      agg->wins[agg->num_wins++] = seginfo->win;
+    }
+  }
+
+  buf->size = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_aggregator_create(
+  dart_team_t         teamid,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  size_t              threshold,
+  dart_aggregator_t * agg)
+{
+  if (agg == NULL) {
+    DART_LOG_ERROR("dart_aggregator_create ! agg must not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *agg = NULL;
+
+  if (dart__unlikely(op > DART_OP_LAST || op == DART_OP_NO_OP ||
+                     op == DART_OP_UNDEFINED)) {
+    DART_LOG_ERROR("dart_aggregator_create ! Unsupported operation %s",
+                   dart__mpi__op_name(op));
+    return DART_ERR_INVAL;
+  }
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_aggregator_create ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (threshold == 0) {
+    threshold = DART_AGGREGATOR_DEFAULT_THRESHOLD;
+  }
+  if (dart__unlikely(threshold > INT_MAX)) {
+    DART_LOG_ERROR("dart_aggregator_create ! threshold (%zu) > INT_MAX",
+                   threshold);
+    return DART_ERR_INVAL;
+  }
+
+  struct dart_aggregator_struct *res = malloc(sizeof(*res));
+  res->teamid     = teamid;
+  res->dtype      = dtype;
+  res->op         = op;
+  res->mpi_dtype  = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  res->mpi_op     = dart__mpi__op(op, dtype);
+  res->dtype_size = dart__mpi__datatype_sizeof(dtype);
+  res->threshold  = threshold;
+  res->nunits     = team_data->size;
+  // per-unit buffers are allocated on first use
+  res->buffers    = calloc(team_data->size, sizeof(agg_buffer_t));
+  res->packed     = malloc(threshold * res->dtype_size);
+  res->disps      = malloc(threshold * sizeof(MPI_Aint));
+  res->wins       = NULL;
+  res->num_wins   = 0;
+
+  DART_LOG_DEBUG("dart_aggregator_create > team:%d dtype:%ld op:%s "
+                 "threshold:%zu", teamid, dtype, dart__mpi__op_name(op),
+                 threshold);
+  *agg = res;
+  return DART_OK;
+}
+
+dart_ret_t dart_aggregator_add(
+  dart_aggregator_t   agg,
+  dart_gptr_t         gptr,
+  const void        * value)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  if (dart__unlikely(agg == NULL || gptr.teamid != agg->teamid)) {
+    DART_LOG_ERROR("dart_aggregator_add ! invalid aggregator or team %i",
+                   gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+  if (dart__unlikely(team_unit_id.id < 0 ||
+                     team_unit_id.id >= agg->nunits)) {
+    DART_LOG_ERROR("dart_aggregator_add ! unitid out of range 0 <= %d < %d",
+                   team_unit_id.id, agg->nunits);
+    return DART_ERR_INVAL;
+  }
+
+  agg_buffer_t *buf = &agg->buffers[team_unit_id.id];
+  if (dart__unlikely(buf->entries == NULL)) {
+    buf->entries = malloc(agg->threshold * sizeof(agg_entry_t));
+    buf->values  = malloc(agg->threshold * agg->dtype_size);
+  }
+
+  agg_entry_t *entry = &buf->entries[buf->size];
+  entry->offset = gptr.addr_or_offs.offset;
+  entry->segid  = gptr.segid;
+  entry->idx    = buf->size;
+  memcpy(buf->values + buf->size * agg->dtype_size, value, agg->dtype_size);
+
+  if (++buf->size == agg->threshold) {
+    return dart__mpi__aggregator_ship(agg, team_unit_id);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_aggregator_flush(
+  dart_aggregator_t   agg)
+{
+  if (dart__unlikely(agg == NULL)) {
+    DART_LOG_ERROR("dart_aggregator_flush ! agg must not be NULL");
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_aggregator_flush()");
+  dart_ret_t ret = DART_OK;
+  for (int u = 0; u < agg->nunits; ++u) {
+    dart_ret_t ship_ret =
+      dart__mpi__aggregator_ship(agg, DART_TEAM_UNIT_ID(u));
+    if (ship_ret != DART_OK) {
+      ret = ship_ret;
+    }
+  }
+  for (int w = 0; w < agg->num_wins; ++w) {
+    CHECK_MPI_RET(MPI_Win_flush_all(agg->wins[w]), "MPI_Win_flush_all");
+  }
+  agg->num_wins = 0;
+
+  DART_LOG_DEBUG("dart_aggregator_flush > finished");
+  return ret;
+}
+
+dart_ret_t dart_aggregator_destroy(
+  dart_aggregator_t * agg)
+{
+  if (agg == NULL || *agg == NULL) {
+    return DART_OK;
+  }
+
+  dart_ret_t ret = dart_aggregator_flush(*agg);
+  for (int u = 0; u < (*agg)->nunits; ++u) {
+    free((*agg)->buffers[u].entries);
+    free((*agg)->buffers[u].values);
+  }
+  free((*agg)->buffers);
+  free((*agg)->packed);
+  free((*agg)->disps);
+  free((*agg)->wins);
+  free(*agg);
+  *agg = NULL;
+  return ret;
+}
+
+/* -- Non-blocking dart one-sided operations -- */
+
+dart_ret_t dart_get_handle(
+    void          * dest,
+    dart_gptr_t     gptr,
+    size_t          nelem,
+    dart_datatype_t src_type,
+    dart_datatype_t dst_type,
+    dart_handle_t * handleptr)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t         offset = gptr.addr_or_offs.offset;
+  int16_t          seg_id = gptr.segid;
+  dart_team_t      teamid = gptr.teamid;
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_get_handle ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+      &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_get_handle ! "
+        "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Win win  = seginfo->win;
 
-  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  dart_handle_t handle = dart__mpi__handle_alloc();
+  if (dart__unlikely(handle == DART_HANDLE_NULL)) {
+    return DART_ERR_OTHER;
+  }
   handle->dest         = team_unit_id.id;
   handle->win          = win;
   handle->needs_flush  = false;
@@ -946,13 +1833,13 @@ dart_ret_t dart_get_handle(
         handle->reqs, &handle->num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
         offset, nelem, src_type, dst_type,
         handle->reqs, &handle->num_reqs);
   }
 
   if (handle->num_reqs == 0) {
-    free(handle);
+    dart__mpi__handle_release(handle);
     handle = DART_HANDLE_NULL;
   }
 
@@ -999,7 +1886,10 @@ dart_ret_t dart_put_handle(
   MPI_Win win  = seginfo->win;
 
   // chunk up the put
-  dart_handle_t handle   = calloc(1, sizeof(struct dart_handle_struct));
+  dart_handle_t handle   = dart__mpi__handle_alloc();
+  if (dart__unlikely(handle == DART_HANDLE_NULL)) {
+    return DART_ERR_OTHER;
+  }
   handle->dest           = team_unit_id.id;
   handle->win            = win;
   handle->needs_flush    = true;
@@ -1017,7 +1907,7 @@ dart_ret_t dart_put_handle(
                                &handle->needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  handle->reqs,
                                  &handle->num_reqs,
@@ -1025,7 +1915,7 @@ dart_ret_t dart_put_handle(
   }
 
   if (handle->num_reqs == 0) {
-    free(handle);
+    dart__mpi__handle_release(handle);
     handle = DART_HANDLE_NULL;
   }
 
@@ -1089,7 +1979,7 @@ dart_ret_t dart_put_blocking(
                                NULL, NULL, &needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  NULL, NULL, &needs_flush);
   }
@@ -1156,7 +2046,7 @@ dart_ret_t dart_get_blocking(
                                reqs, &num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
                                  offset, nelem, src_type, dst_type,
                                  reqs, &num_reqs);
   }
@@ -1170,8 +2060,383 @@ dart_ret_t dart_get_blocking(
   return DART_OK;
 }
 
+/* -- Vectored dart one-sided operations -- */
+
+typedef struct {
+  dart_gptr_t gptr;
+  /// position of the transfer in the arguments passed by the caller
+  size_t      idx;
+} rmav_entry_t;
+
+static int rmav_entry_cmp(const void *lhs_ptr, const void *rhs_ptr)
+{
+  const dart_gptr_t *lhs = &((const rmav_entry_t *)lhs_ptr)->gptr;
+  const dart_gptr_t *rhs = &((const rmav_entry_t *)rhs_ptr)->gptr;
+  if (lhs->teamid != rhs->teamid) return (lhs->teamid < rhs->teamid) ? -1 : 1;
+  if (lhs->segid  != rhs->segid)  return (lhs->segid  < rhs->segid)  ? -1 : 1;
+  if (lhs->unitid != rhs->unitid) return (lhs->unitid < rhs->unitid) ? -1 : 1;
+  if (lhs->addr_or_offs.offset != rhs->addr_or_offs.offset) {
+    return (lhs->addr_or_offs.offset < rhs->addr_or_offs.offset) ? -1 : 1;
+  }
+  return 0;
+}
+
+static inline bool rmav_same_target(
+  const dart_gptr_t * lhs,
+  const dart_gptr_t * rhs)
+{
+  return (lhs->teamid == rhs->teamid &&
+          lhs->segid  == rhs->segid  &&
+          lhs->unitid == rhs->unitid);
+}
+
+/**
+ * Common implementation of \c dart_getv and \c dart_putv.
+ *
+ * Transfers are grouped by target unit and segment and sorted by offset.
+ * Node-local targets are served by memcpy, all other targets by a single
+ * RMA operation per group using an indexed MPI type in which adjacent
+ * target ranges are merged.
+ */
+static dart_ret_t dart__mpi__rmav(
+  bool                is_get,
+  void      * const * local,
+  const dart_gptr_t * gptrs,
+  size_t              num,
+  size_t              nelem,
+  dart_datatype_t     dtype)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  if (num == 0) {
+    return DART_OK;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS || num > INT_MAX)) {
+    DART_LOG_ERROR("%s ! failed: nelem (%zu) or num (%zu) > INT_MAX",
+                   is_get ? "dart_getv" : "dart_putv", nelem, num);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  size_t       elem_size = dart__mpi__datatype_sizeof(dtype);
+  size_t       nbytes    = nelem * elem_size;
+
+  rmav_entry_t * entries   = malloc(num * sizeof(rmav_entry_t));
+  MPI_Aint     * tgt_disps = malloc(num * sizeof(MPI_Aint));
+  int          * tgt_lens  = malloc(num * sizeof(int));
+  MPI_Aint     * org_disps = malloc(num * sizeof(MPI_Aint));
+  MPI_Request  * reqs      = malloc(num * sizeof(MPI_Request));
+  MPI_Win      * wins      = malloc(num * sizeof(MPI_Win));
+  int          * ranks     = malloc(num * sizeof(int));
+  int            num_reqs  = 0;
+  dart_ret_t     ret       = DART_OK;
+
+  if (dart__unlikely(entries == NULL || tgt_disps == NULL ||
+                     tgt_lens == NULL || org_disps == NULL ||
+                     reqs == NULL || wins == NULL || ranks == NULL)) {
+    DART_LOG_ERROR("%s ! failed to allocate buffers for %zu transfers",
+                   is_get ? "dart_getv" : "dart_putv", num);
+    free(entries);
+    free(tgt_disps);
+    free(tgt_lens);
+    free(org_disps);
+    free(reqs);
+    free(wins);
+    free(ranks);
+    return DART_ERR_OTHER;
+  }
+
+  for (size_t i = 0; i < num; ++i) {
+    entries[i].gptr = gptrs[i];
+    entries[i].idx  = i;
+  }
+  qsort(entries, num, sizeof(rmav_entry_t), &rmav_entry_cmp);
+
+  for (size_t begin = 0, end; begin < num; begin = end) {
+    const dart_gptr_t *gptr = &entries[begin].gptr;
+    for (end = begin + 1;
+         end < num && rmav_same_target(gptr, &entries[end].gptr);
+         ++end) { }
+
+    dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr->unitid);
+    dart_team_data_t *team_data   = dart_adapt_teamlist_get(gptr->teamid);
+    if (dart__unlikely(team_data == NULL)) {
+      DART_LOG_ERROR("%s ! failed: Unknown team %i!",
+                     is_get ? "dart_getv" : "dart_putv", gptr->teamid);
+      ret = DART_ERR_INVAL;
+      break;
+    }
+    if (dart__unlikely(team_unit_id.id < 0 ||
+                       team_unit_id.id >= team_data->size)) {
+      DART_LOG_ERROR("%s ! failed: unitid out of range 0 <= %d < %d",
+                     is_get ? "dart_getv" : "dart_putv",
+                     team_unit_id.id, team_data->size);
+      ret = DART_ERR_INVAL;
+      break;
+    }
+    dart_segment_info_t *seginfo = dart_segment_get_info(
+                                      &(team_data->segdata), gptr->segid);
+    if (dart__unlikely(seginfo == NULL)) {
+      DART_LOG_ERROR("%s ! Unknown segment %i on team %i",
+                     is_get ? "dart_getv" : "dart_putv",
+                     gptr->segid, gptr->teamid);
+      ret = DART_ERR_INVAL;
+      break;
+    }
+
+    char * baseptr = local_target_ptr(team_data, seginfo, 0, team_unit_id);
+    if (baseptr != NULL) {
+      DART_LOG_TRACE("%s: memcpy of %zu transfers to unit %d",
+                     is_get ? "dart_getv" : "dart_putv",
+                     end - begin, team_unit_id.id);
+      for (size_t i = begin; i < end; ++i) {
+        char *target = baseptr + entries[i].gptr.addr_or_offs.offset;
+        if (is_get) {
+          memcpy(local[entries[i].idx], target, nbytes);
+        } else {
+          memcpy(target, local[entries[i].idx], nbytes);
+        }
+      }
+      continue;
+    }
+
+    // merge adjacent target ranges, the origin buffers are addressed
+    // individually
+    MPI_Aint disp     = dart_segment_disp(seginfo, team_unit_id);
+    int      num_runs = 0;
+    for (size_t i = begin; i < end; ++i) {
+      MPI_Aint offset = disp + entries[i].gptr.addr_or_offs.offset;
+      if (num_runs > 0 &&
+          tgt_disps[num_runs-1] +
+            (MPI_Aint)(tgt_lens[num_runs-1] * elem_size)
+            == offset &&
+          (size_t)tgt_lens[num_runs-1] + nelem <= MAX_CONTIG_ELEMENTS) {
+        tgt_lens[num_runs-1] += nelem;
+      } else {
+        tgt_disps[num_runs] = offset;
+        tgt_lens[num_runs]  = nelem;
+        ++num_runs;
+      }
+      MPI_Get_address(local[entries[i].idx], &org_disps[i - begin]);
+    }
+    // target displacements relative to the first run, dynamic windows
+    // look up the attached memory region by the target displacement
+    MPI_Aint tgt_base = tgt_disps[0];
+    for (int r = 0; r < num_runs; ++r) {
+      tgt_disps[r] -= tgt_base;
+    }
+
+    MPI_Datatype org_type, tgt_type;
+    CHECK_MPI_RET(
+      MPI_Type_create_hindexed_block(
+        end - begin, nelem, org_disps, mpi_dtype, &org_type),
+      "MPI_Type_create_hindexed_block");
+    CHECK_MPI_RET(
+      MPI_Type_create_hindexed(
+        num_runs, tgt_lens, tgt_disps, mpi_dtype, &tgt_type),
+      "MPI_Type_create_hindexed");
+    MPI_Type_commit(&org_type);
+    MPI_Type_commit(&tgt_type);
+
+    DART_LOG_TRACE("%s: %zu transfers in %d runs to unit %d",
+                   is_get ? "dart_getv" : "dart_putv",
+                   end - begin, num_runs, team_unit_id.id);
+    if (is_get) {
+      CHECK_MPI_RET(
+        MPI_Rget(MPI_BOTTOM, 1, org_type, team_unit_id.id,
+                 tgt_base, 1, tgt_type, seginfo->win, &reqs[num_reqs]),
+        "MPI_Rget");
+    } else {
+      CHECK_MPI_RET(
+        MPI_Put(MPI_BOTTOM, 1, org_type, team_unit_id.id,
+                tgt_base, 1, tgt_type, seginfo->win),
+        "MPI_Put");
+    }
+    wins[num_reqs]  = seginfo->win;
+    ranks[num_reqs] = team_unit_id.id;
+    ++num_reqs;
+
+    // deallocation is deferred until the operation has completed
+    MPI_Type_free(&org_type);
+    MPI_Type_free(&tgt_type);
+  }
+
+  if (is_get) {
+    if (num_reqs > 0) {
+      CHECK_MPI_RET(
+        MPI_Waitall(num_reqs, reqs, MPI_STATUSES_IGNORE), "MPI_Waitall");
+    }
+  } else {
+    for (int i = 0; i < num_reqs; ++i) {
+      CHECK_MPI_RET(MPI_Win_flush(ranks[i], wins[i]), "MPI_Win_flush");
+    }
+  }
+
+  free(entries);
+  free(tgt_disps);
+  free(tgt_lens);
+  free(org_disps);
+  free(reqs);
+  free(wins);
+  free(ranks);
+
+  return ret;
+}
+
+dart_ret_t dart_getv(
+  void            * const dest[],
+  const dart_gptr_t       gptrs[],
+  size_t                  num,
+  size_t                  nelem,
+  dart_datatype_t         dtype)
+{
+  DART_LOG_DEBUG("dart_getv() num:%zu nelem:%zu", num, nelem);
+  dart_ret_t ret = dart__mpi__rmav(true, dest, gptrs, num, nelem, dtype);
+  DART_LOG_DEBUG("dart_getv > finished");
+  return ret;
+}
+
+dart_ret_t dart_putv(
+  const dart_gptr_t       gptrs[],
+  const void      * const src[],
+  size_t                  num,
+  size_t                  nelem,
+  dart_datatype_t         dtype)
+{
+  DART_LOG_DEBUG("dart_putv() num:%zu nelem:%zu", num, nelem);
+  dart_ret_t ret = dart__mpi__rmav(
+                      false, (void * const *)src, gptrs, num, nelem, dtype);
+  DART_LOG_DEBUG("dart_putv > finished");
+  return ret;
+}
+
 /* -- Dart RMA Synchronization Operations -- */
 
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_gptr_t       notify_gptr,
+  int64_t           value)
+{
+  DART_LOG_DEBUG("dart_put_notify() uid:%d o:%"PRIu64" s:%d t:%d nelem:%zu "
+                 "notify uid:%d o:%"PRIu64" value:%"PRId64,
+                 gptr.unitid, gptr.addr_or_offs.offset, gptr.segid,
+                 gptr.teamid, nelem, notify_gptr.unitid,
+                 notify_gptr.addr_or_offs.offset, value);
+
+  /*
+   * The payload has to be complete at the target before the notification
+   * is issued as MPI does not order operations on different locations.
+   */
+  dart_ret_t ret = dart_put_blocking(gptr, src, nelem, dtype, dtype);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_put_notify ! payload transfer failed");
+    return ret;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(notify_gptr.teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_put_notify ! failed: Unknown team %i!",
+                   notify_gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(notify_gptr.unitid);
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), notify_gptr.segid);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_put_notify ! Unknown segment %i on team %i",
+                   notify_gptr.segid, notify_gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Win  win    = seginfo->win;
+  uint64_t offset = notify_gptr.addr_or_offs.offset +
+                      dart_segment_disp(seginfo, team_unit_id);
+
+  // order stores of a payload copied through shared memory before the
+  // notification
+  CHECK_MPI_RET(MPI_Win_sync(win), "MPI_Win_sync");
+
+  CHECK_MPI_RET(
+    MPI_Accumulate(
+      &value, 1, MPI_INT64_T,
+      team_unit_id.id, offset, 1, MPI_INT64_T,
+      MPI_SUM, win),
+    "MPI_Accumulate");
+  // complete the notification at the target to guarantee progress
+  CHECK_MPI_RET(MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
+
+  DART_LOG_DEBUG("dart_put_notify > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_notify_wait(
+  dart_gptr_t       counter,
+  int64_t           expected)
+{
+  DART_LOG_DEBUG("dart_notify_wait() o:%"PRIu64" s:%d t:%d expected:%"PRId64,
+                 counter.addr_or_offs.offset, counter.segid, counter.teamid,
+                 expected);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(counter.teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_notify_wait ! failed: Unknown team %i!",
+                   counter.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(counter.unitid);
+  if (dart__unlikely(team_unit_id.id != team_data->unitid)) {
+    DART_LOG_ERROR("dart_notify_wait ! counter is not local (unit %d)",
+                   team_unit_id.id);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), counter.segid);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_notify_wait ! Unknown segment %i on team %i",
+                   counter.segid, counter.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Win  win    = seginfo->win;
+  uint64_t offset = counter.addr_or_offs.offset +
+                      dart_segment_disp(seginfo, team_unit_id);
+
+  /*
+   * Read the counter through MPI to stay consistent with the atomic
+   * updates issued by dart_put_notify. Targeting the calling unit, this
+   * does not involve any communication.
+   */
+  int64_t current;
+  do {
+    CHECK_MPI_RET(
+      MPI_Fetch_and_op(
+        NULL, &current, MPI_INT64_T,
+        team_unit_id.id, offset,
+        MPI_NO_OP, win),
+      "MPI_Fetch_and_op");
+    CHECK_MPI_RET(
+      MPI_Win_flush_local(team_unit_id.id, win), "MPI_Win_flush_local");
+  } while (current < expected);
+
+  // make payloads written through shared memory visible
+  CHECK_MPI_RET(MPI_Win_sync(win), "MPI_Win_sync");
+
+  DART_LOG_DEBUG("dart_notify_wait > counter:%"PRId64, current);
+  return DART_OK;
+}
+
 dart_ret_t dart_flush(
   dart_gptr_t gptr)
 {
@@ -1209,11 +2474,13 @@ dart_ret_t dart_flush(
   CHECK_MPI_RET(
     MPI_Win_sync(win), "MPI_Win_sync");
 
-  // trigger progress
-  int flag;
-  CHECK_MPI_RET(
-    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
-    "MPI_Iprobe");
+  // trigger progress unless the progress thread takes care of it
+  if (!dart__mpi__progress_active()) {
+    int flag;
+    CHECK_MPI_RET(
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
+      "MPI_Iprobe");
+  }
 
   DART_LOG_DEBUG("dart_flush > finished");
   return DART_OK;
@@ -1254,11 +2521,13 @@ dart_ret_t dart_flush_all(
   CHECK_MPI_RET(
     MPI_Win_sync(win), "MPI_Win_sync");
 
-  // trigger progress
-  int flag;
-  CHECK_MPI_RET(
-    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
-    "MPI_Iprobe");
+  // trigger progress unless the progress thread takes care of it
+  if (!dart__mpi__progress_active()) {
+    int flag;
+    CHECK_MPI_RET(
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
+      "MPI_Iprobe");
+  }
 
   DART_LOG_DEBUG("dart_flush_all > finished");
   return DART_OK;
@@ -1299,11 +2568,13 @@ dart_ret_t dart_flush_local(
     MPI_Win_flush_local(team_unit_id.id, win),
     "MPI_Win_flush_local");
 
-  // trigger progress
-  int flag;
-  CHECK_MPI_RET(
-    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
-    "MPI_Iprobe");
+  // trigger progress unless the progress thread takes care of it
+  if (!dart__mpi__progress_active()) {
+    int flag;
+    CHECK_MPI_RET(
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
+      "MPI_Iprobe");
+  }
 
   DART_LOG_DEBUG("dart_flush_local > finished");
   return DART_OK;
@@ -1340,11 +2611,13 @@ dart_ret_t dart_flush_local_all(
     MPI_Win_flush_local_all(win),
     "MPI_Win_flush_local_all");
 
-  // trigger progress
-  int flag;
-  CHECK_MPI_RET(
-    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
-    "MPI_Iprobe");
+  // trigger progress unless the progress thread takes care of it
+  if (!dart__mpi__progress_active()) {
+    int flag;
+    CHECK_MPI_RET(
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
+      "MPI_Iprobe");
+  }
 
   DART_LOG_DEBUG("dart_flush_local_all > finished");
   return DART_OK;
@@ -1372,7 +2645,7 @@ dart_ret_t dart_wait_local(
     } else {
       DART_LOG_TRACE("dart_wait_local:     handle->num_reqs == 0");
     }
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait_local > finished");
@@ -1406,7 +2679,7 @@ dart_ret_t dart_wait(
       DART_LOG_TRACE("dart_wait:     handle->num_reqs == 0");
     }
     /* Free handle resource */
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait > finished");
@@ -1430,7 +2703,11 @@ dart_ret_t dart_waitall_local(
   }
   if (handles != NULL) {
     size_t r_n = 0;
-    MPI_Request *mpi_req = ALLOC_TMP(2 * num_handles * sizeof(MPI_Request));
+    MPI_Request *mpi_req = dart__mpi__handle_scratch(2 * num_handles);
+    if (dart__unlikely(mpi_req == NULL)) {
+      DART_LOG_ERROR("dart_waitall_local ! failed to allocate requests");
+      return DART_ERR_OTHER;
+    }
     for (size_t i = 0; i < num_handles; ++i) {
       if (handles[i] != DART_HANDLE_NULL) {
         for (uint8_t j = 0; j < handles[i]->num_reqs; ++j) {
@@ -1455,12 +2732,10 @@ dart_ret_t dart_waitall_local(
     if (r_n > 0) {
       if (MPI_Waitall(r_n, mpi_req, MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
         DART_LOG_ERROR("dart_waitall_local: MPI_Waitall failed");
-        FREE_TMP(2 * num_handles * sizeof(MPI_Request), mpi_req);
         return DART_ERR_INVAL;
       }
     } else {
       DART_LOG_DEBUG("dart_waitall_local > number of requests = 0");
-      FREE_TMP(2 * num_handles * sizeof(MPI_Request), mpi_req);
       return DART_OK;
     }
 
@@ -1473,11 +2748,10 @@ dart_ret_t dart_waitall_local(
         DART_LOG_TRACE("dart_waitall_local: free handle[%zu] %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_release(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
-    FREE_TMP(2 * num_handles * sizeof(MPI_Request), mpi_req);
   }
   DART_LOG_DEBUG("dart_waitall_local > %d", ret);
   return ret;
@@ -1522,7 +2796,11 @@ dart_ret_t dart_waitall(
   DART_LOG_DEBUG("dart_waitall: number of handles: %zu", n);
 
   if (handles != NULL) {
-    MPI_Request *mpi_req = ALLOC_TMP(2 * n * sizeof(MPI_Request));
+    MPI_Request *mpi_req = dart__mpi__handle_scratch(2 * n);
+    if (dart__unlikely(mpi_req == NULL)) {
+      DART_LOG_ERROR("dart_waitall ! failed to allocate requests");
+      return DART_ERR_OTHER;
+    }
     /*
      * copy requests from DART handles to MPI request array:
      */
@@ -1563,12 +2841,10 @@ dart_ret_t dart_waitall(
     if (r_n > 0) {
       if (MPI_Waitall(r_n, mpi_req, MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
         DART_LOG_ERROR("dart_waitall: MPI_Waitall failed");
-        FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
         return DART_ERR_INVAL;
       }
     } else {
       DART_LOG_DEBUG("dart_waitall > number of requests = 0");
-      FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
       return DART_OK;
     }
 
@@ -1578,7 +2854,6 @@ dart_ret_t dart_waitall(
     DART_LOG_DEBUG("dart_waitall: waiting for remote completion");
     if (DART_OK != wait_remote_completion(handles, n)) {
       DART_LOG_ERROR("dart_waitall: MPI_Win_flush failed");
-      FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
       return DART_ERR_OTHER;
     }
 
@@ -1592,12 +2867,10 @@ dart_ret_t dart_waitall(
         DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_release(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
-    DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-    FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
   }
   DART_LOG_DEBUG("dart_waitall > finished");
   return DART_OK;
@@ -1658,7 +2931,7 @@ dart_ret_t dart_test_local(
 
   if (flag) {
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1695,7 +2968,7 @@ dart_ret_t dart_test(
       );
     }
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1718,7 +2991,11 @@ dart_ret_t dart_testall_local(
   }
   *is_finished = 0;
 
-  MPI_Request *mpi_req = ALLOC_TMP(2 * n * sizeof (MPI_Request));
+  MPI_Request *mpi_req = dart__mpi__handle_scratch(2 * n);
+  if (dart__unlikely(mpi_req == NULL)) {
+    DART_LOG_ERROR("dart_testall_local ! failed to allocate requests");
+    return DART_ERR_OTHER;
+  }
   size_t r_n = 0;
   for (size_t i = 0; i < n; ++i) {
     if (handles[i] != DART_HANDLE_NULL) {
@@ -1733,7 +3010,6 @@ dart_ret_t dart_testall_local(
 
   if (r_n) {
     if (dart__mpi__testall(r_n, mpi_req, &flag) != MPI_SUCCESS){
-      FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
       DART_LOG_ERROR("dart_testall_local: MPI_Testall failed!");
       return DART_ERR_OTHER;
     }
@@ -1742,7 +3018,7 @@ dart_ret_t dart_testall_local(
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_release(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1751,7 +3027,6 @@ dart_ret_t dart_testall_local(
   } else {
     *is_finished = 1;
   }
-  FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
   DART_LOG_DEBUG("dart_testall_local > finished");
   return DART_OK;
 }
@@ -1768,7 +3043,11 @@ dart_ret_t dart_testall(
     return DART_OK;
   }
 
-  MPI_Request *mpi_req = ALLOC_TMP(2 * n * sizeof (MPI_Request));
+  MPI_Request *mpi_req = dart__mpi__handle_scratch(2 * n);
+  if (dart__unlikely(mpi_req == NULL)) {
+    DART_LOG_ERROR("dart_testall ! failed to allocate requests");
+    return DART_ERR_OTHER;
+  }
   size_t r_n = 0;
   for (size_t i = 0; i < n; ++i) {
     if (handles[i] != DART_HANDLE_NULL) {
@@ -1785,7 +3064,6 @@ dart_ret_t dart_testall(
     DART_LOG_TRACE("  MPI_Testall on %zu requests", r_n);
     if (dart__mpi__testall(r_n, mpi_req, is_finished) != MPI_SUCCESS){
       DART_LOG_ERROR("dart_testall: MPI_Testall failed");
-      FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
       return DART_ERR_OTHER;
     }
 
@@ -1796,14 +3074,13 @@ dart_ret_t dart_testall(
       DART_LOG_DEBUG("dart_testall: waiting for remote completion");
       if (DART_OK != wait_remote_completion(handles, n)) {
         DART_LOG_ERROR("dart_testall: MPI_Win_flush failed");
-        FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
         return DART_ERR_OTHER;
       }
 
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_release(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1811,7 +3088,6 @@ dart_ret_t dart_testall(
   } else {
     *is_finished = 1;
   }
-  FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
   DART_LOG_DEBUG("dart_testall_local > finished");
   return DART_OK;
 }
@@ -1820,14 +3096,401 @@ dart_ret_t dart_handle_free(
   dart_handle_t * handleptr)
 {
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
-    free(*handleptr);
+    dart__mpi__handle_release(*handleptr);
     *handleptr = DART_HANDLE_NULL;
   }
   return DART_OK;
 }
 
+
+/* -- Handle groups -- */
+
+dart_ret_t dart_handle_group_create(
+  size_t               capacity,
+  dart_handle_group_t* group)
+{
+  if (dart__unlikely(group == NULL)) {
+    DART_LOG_ERROR("dart_handle_group_create ! group must not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *group = DART_HANDLE_GROUP_NULL;
+
+  dart_handle_group_t res = calloc(1, sizeof(struct dart_handle_group_struct));
+  if (res == NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (capacity > 0) {
+    // a transfer consists of at most two requests
+    res->reqs = malloc(2 * capacity * sizeof(MPI_Request));
+    if (res->reqs == NULL) {
+      free(res);
+      return DART_ERR_OTHER;
+    }
+    res->capacity = 2 * capacity;
+  }
+  *group = res;
+  DART_LOG_DEBUG("dart_handle_group_create > group:%p capacity:%zu",
+                 (void*)res, capacity);
+  return DART_OK;
+}
+
+/**
+ * Make room for \c n more requests in \c group.
+ */
+static
+dart_ret_t handle_group_reserve(
+  dart_handle_group_t group,
+  size_t              n)
+{
+  if (dart__likely(group->num_reqs + n <= group->capacity)) {
+    return DART_OK;
+  }
+  size_t capacity = (group->capacity > 0) ? group->capacity : 16;
+  while (capacity < group->num_reqs + n) {
+    capacity *= 2;
+  }
+  MPI_Request *reqs = realloc(group->reqs, capacity * sizeof(MPI_Request));
+  if (reqs == NULL) {
+    DART_LOG_ERROR("dart_handle_group ! failed to allocate %zu requests",
+                   capacity);
+    return DART_ERR_OTHER;
+  }
+  group->reqs     = reqs;
+  group->capacity = capacity;
+  return DART_OK;
+}
+
+/**
+ * Record that operations on \c win have to be flushed for remote
+ * completion of \c group.
+ */
+static
+dart_ret_t handle_group_add_flush(
+  dart_handle_group_t group,
+  MPI_Win             win)
+{
+  for (int i = 0; i < group->num_flush_wins; ++i) {
+    if (group->flush_wins[i] == win) {
+      return DART_OK;
+    }
+  }
+  if (group->num_flush_wins == group->flush_capacity) {
+    int capacity = (group->flush_capacity > 0) ? 2 * group->flush_capacity
+                                                : 4;
+    MPI_Win *wins = realloc(group->flush_wins, capacity * sizeof(MPI_Win));
+    if (wins == NULL) {
+      return DART_ERR_OTHER;
+    }
+    group->flush_wins     = wins;
+    group->flush_capacity = capacity;
+  }
+  group->flush_wins[group->num_flush_wins++] = win;
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_group_get(
+  dart_handle_group_t group,
+  void              * dest,
+  dart_gptr_t         gptr,
+  size_t              nelem,
+  dart_datatype_t     src_type,
+  dart_datatype_t     dst_type)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t         offset = gptr.addr_or_offs.offset;
+  int16_t          seg_id = gptr.segid;
+  dart_team_t      teamid = gptr.teamid;
+
+  if (dart__unlikely(group == DART_HANDLE_GROUP_NULL)) {
+    DART_LOG_ERROR("dart_handle_group_get ! invalid group");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_handle_group_get ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+      &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_handle_group_get ! "
+        "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (handle_group_reserve(group, 2) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
+  DART_LOG_DEBUG("dart_handle_group_get() uid:%d o:%"PRIu64" s:%d t:%d "
+                 "nelem:%zu", team_unit_id.id, offset, seg_id, teamid, nelem);
+
+  dart_ret_t ret      = DART_OK;
+  uint8_t    num_reqs = 0;
+  if (dart__mpi__datatype_iscontiguous(src_type) &&
+      dart__mpi__datatype_iscontiguous(dst_type)) {
+    CHECK_EQUAL_BASETYPE(src_type, dst_type);
+    ret = dart__mpi__get_basic(team_data, team_unit_id, seginfo, dest,
+        offset, nelem, src_type,
+        group->reqs + group->num_reqs, &num_reqs);
+  } else {
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
+        offset, nelem, src_type, dst_type,
+        group->reqs + group->num_reqs, &num_reqs);
+  }
+  group->num_reqs += num_reqs;
+  return ret;
+}
+
+dart_ret_t dart_handle_group_put(
+  dart_handle_group_t group,
+  dart_gptr_t         gptr,
+  const void        * src,
+  size_t              nelem,
+  dart_datatype_t     src_type,
+  dart_datatype_t     dst_type)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t         offset = gptr.addr_or_offs.offset;
+  int16_t          seg_id = gptr.segid;
+  dart_team_t      teamid = gptr.teamid;
+
+  if (dart__unlikely(group == DART_HANDLE_GROUP_NULL)) {
+    DART_LOG_ERROR("dart_handle_group_put ! invalid group");
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_EQUAL_BASETYPE(src_type, dst_type);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_handle_group_put ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_handle_group_put ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (handle_group_reserve(group, 2) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
+  DART_LOG_DEBUG("dart_handle_group_put() uid:%d o:%"PRIu64" s:%d t:%d "
+                 "nelem:%zu", team_unit_id.id, offset, seg_id, teamid, nelem);
+
+  dart_ret_t ret         = DART_OK;
+  uint8_t    num_reqs    = 0;
+  bool       needs_flush = true;
+  if (dart__mpi__datatype_iscontiguous(src_type) &&
+      dart__mpi__datatype_iscontiguous(dst_type)) {
+    ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
+                               offset, nelem, src_type,
+                               group->reqs + group->num_reqs,
+                               &num_reqs, &needs_flush);
+  } else {
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
+                                 offset, nelem, src_type, dst_type,
+                                 group->reqs + group->num_reqs,
+                                 &num_reqs, &needs_flush);
+  }
+  group->num_reqs += num_reqs;
+  if (ret == DART_OK && num_reqs > 0 && needs_flush) {
+    ret = handle_group_add_flush(group, seginfo->win);
+  }
+  return ret;
+}
+
+dart_ret_t dart_handle_group_add(
+  dart_handle_group_t group,
+  dart_handle_t     * handleptr)
+{
+  if (dart__unlikely(group == DART_HANDLE_GROUP_NULL)) {
+    DART_LOG_ERROR("dart_handle_group_add ! invalid group");
+    return DART_ERR_INVAL;
+  }
+  if (handleptr == NULL || *handleptr == DART_HANDLE_NULL) {
+    return DART_OK;
+  }
+  dart_handle_t handle = *handleptr;
+  // temporaries of v-collectives have to outlive the operation
+  if (dart__unlikely(handle->tmpbuf != NULL)) {
+    DART_LOG_ERROR("dart_handle_group_add ! "
+                   "handles of v-collectives cannot be grouped");
+    return DART_ERR_INVAL;
+  }
+  if (handle_group_reserve(group, handle->num_reqs) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+  if (handle->needs_flush &&
+      handle_group_add_flush(group, handle->win) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+  for (uint8_t i = 0; i < handle->num_reqs; ++i) {
+    group->reqs[group->num_reqs++] = handle->reqs[i];
+  }
+  dart__mpi__handle_release(handle);
+  *handleptr = DART_HANDLE_NULL;
+  return DART_OK;
+}
+
+/**
+ * Flush all windows recorded in \c group and reset the group.
+ */
+static
+dart_ret_t handle_group_complete(
+  dart_handle_group_t group,
+  bool                remote)
+{
+  if (remote) {
+    for (int i = 0; i < group->num_flush_wins; ++i) {
+      CHECK_MPI_RET(
+        MPI_Win_flush_all(group->flush_wins[i]), "MPI_Win_flush_all");
+    }
+  }
+  group->num_reqs       = 0;
+  group->num_flush_wins = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_group_wait(
+  dart_handle_group_t group)
+{
+  if (group == DART_HANDLE_GROUP_NULL) {
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart_handle_group_wait() group:%p num_reqs:%zu",
+                 (void*)group, group->num_reqs);
+  if (group->num_reqs > 0) {
+    if (dart__unlikely(group->num_reqs > INT_MAX)) {
+      DART_LOG_ERROR("dart_handle_group_wait ! number of requests > INT_MAX");
+      return DART_ERR_INVAL;
+    }
+    CHECK_MPI_RET(
+      MPI_Waitall(group->num_reqs, group->reqs, MPI_STATUSES_IGNORE),
+      "MPI_Waitall");
+  }
+  return handle_group_complete(group, true);
+}
+
+dart_ret_t dart_handle_group_wait_local(
+  dart_handle_group_t group)
+{
+  if (group == DART_HANDLE_GROUP_NULL) {
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart_handle_group_wait_local() group:%p num_reqs:%zu",
+                 (void*)group, group->num_reqs);
+  if (group->num_reqs > 0) {
+    if (dart__unlikely(group->num_reqs > INT_MAX)) {
+      DART_LOG_ERROR("dart_handle_group_wait_local ! "
+                     "number of requests > INT_MAX");
+      return DART_ERR_INVAL;
+    }
+    CHECK_MPI_RET(
+      MPI_Waitall(group->num_reqs, group->reqs, MPI_STATUSES_IGNORE),
+      "MPI_Waitall");
+  }
+  return handle_group_complete(group, false);
+}
+
+static
+dart_ret_t handle_group_test(
+  dart_handle_group_t group,
+  int32_t           * is_finished,
+  bool                remote)
+{
+  *is_finished = 1;
+  if (group == DART_HANDLE_GROUP_NULL) {
+    return DART_OK;
+  }
+  if (group->num_reqs > 0) {
+    if (dart__unlikely(group->num_reqs > INT_MAX)) {
+      DART_LOG_ERROR("dart_handle_group_test ! number of requests > INT_MAX");
+      return DART_ERR_INVAL;
+    }
+    int flag;
+    CHECK_MPI_RET(
+      dart__mpi__testall(group->num_reqs, group->reqs, &flag),
+      "MPI_Testall");
+    if (!flag) {
+      *is_finished = 0;
+      return DART_OK;
+    }
+  }
+  return handle_group_complete(group, remote);
+}
+
+dart_ret_t dart_handle_group_test(
+  dart_handle_group_t group,
+  int32_t           * is_finished)
+{
+  return handle_group_test(group, is_finished, true);
+}
+
+dart_ret_t dart_handle_group_test_local(
+  dart_handle_group_t group,
+  int32_t           * is_finished)
+{
+  return handle_group_test(group, is_finished, false);
+}
+
+dart_ret_t dart_handle_group_destroy(
+  dart_handle_group_t * group)
+{
+  if (group == NULL || *group == DART_HANDLE_GROUP_NULL) {
+    return DART_OK;
+  }
+  dart_handle_group_t g = *group;
+  dart_ret_t ret = DART_OK;
+  for (size_t i = 0; i < g->num_reqs; ++i) {
+    if (g->reqs[i] != MPI_REQUEST_NULL &&
+        MPI_Request_free(&g->reqs[i]) != MPI_SUCCESS) {
+      ret = DART_ERR_OTHER;
+    }
+  }
+  free(g->reqs);
+  free(g->flush_wins);
+  free(g);
+  *group = DART_HANDLE_GROUP_NULL;
+  return ret;
+}
+
 /* -- Dart collective operations -- */
 
+/**
+ * Convert \c n element counts or displacements to the int values expected
+ * by MPI, fails if any of the values exceeds \c MAX_CONTIG_ELEMENTS.
+ */
+static inline
+dart_ret_t dart__mpi__counts_to_int(
+  const size_t * counts,
+  int          * icounts,
+  int            n)
+{
+  for (int i = 0; i < n; ++i) {
+    if (dart__unlikely(counts[i] > MAX_CONTIG_ELEMENTS)) {
+      DART_LOG_ERROR("count or displacement %i (%zu) > INT_MAX",
+                     i, counts[i]);
+      return DART_ERR_INVAL;
+    }
+    icounts[i] = counts[i];
+  }
+  return DART_OK;
+}
+
 static int _dart_barrier_count = 0;
 
 dart_ret_t dart_barrier(
@@ -2256,38 +3919,174 @@ dart_ret_t dart_alltoall(
   return DART_OK;
 }
 
-dart_ret_t dart_reduce(
-  const void        * sendbuf,
-  void              * recvbuf,
-  size_t              nelem,
-  dart_datatype_t     dtype,
-  dart_operation_t    op,
-  dart_team_unit_t    root,
-  dart_team_t         team)
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
 {
-  MPI_Comm     comm;
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  int comm_size = team_data->size;
+
+  int *isendcounts = ALLOC_TMP(sizeof(int) * 4 * comm_size);
+  int *isenddispls = isendcounts + comm_size;
+  int *irecvcounts = isenddispls + comm_size;
+  int *irecvdispls = irecvcounts + comm_size;
+  if (dart__mpi__counts_to_int(nsendelem,  isendcounts, comm_size)
+        != DART_OK ||
+      dart__mpi__counts_to_int(senddispls, isenddispls, comm_size)
+        != DART_OK ||
+      dart__mpi__counts_to_int(nrecvelem,  irecvcounts, comm_size)
+        != DART_OK ||
+      dart__mpi__counts_to_int(recvdispls, irecvdispls, comm_size)
+        != DART_OK) {
+    DART_LOG_ERROR("dart_alltoallv ! failed: invalid counts");
+    FREE_TMP(sizeof(int) * 4 * comm_size, isendcounts);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Datatype mpi_dtype =
+    dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  CHECK_MPI_RET(
+      MPI_Alltoallv(
+          sendbuf,
+          isendcounts,
+          isenddispls,
+          mpi_dtype,
+          recvbuf,
+          irecvcounts,
+          irecvdispls,
+          mpi_dtype,
+          team_data->comm),
+      "MPI_Alltoallv");
+
+  FREE_TMP(sizeof(int) * 4 * comm_size, isendcounts);
+
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
+/**
+ * Common implementation of \c dart_scan and \c dart_exscan.
+ */
+static dart_ret_t dart__mpi__scan(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        teamid,
+  bool               exclusive)
+{
+  const char * name = exclusive ? "dart_exscan" : "dart_scan";
+
   CHECK_IS_CONTIGUOUSTYPE(dtype);
+
   MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
   MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
-    DART_LOG_ERROR("dart_allreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    DART_LOG_ERROR("%s ! failed: nelem (%zu) > INT_MAX", name, nelem);
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (dart__unlikely(team_data == NULL)) {
-    DART_LOG_ERROR("dart_reduce ! unknown teamid %d", team);
+    DART_LOG_ERROR("%s ! unknown teamid %d", name, teamid);
     return DART_ERR_INVAL;
   }
 
-  CHECK_UNITID_RANGE(root, team_data);
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
 
-  comm = team_data->comm;
-  CHECK_MPI_RET(
-    MPI_Reduce(
+  if (exclusive) {
+    CHECK_MPI_RET(
+      MPI_Exscan(sendbuf, recvbuf, nelem, mpi_dtype, mpi_op,
+                 team_data->comm),
+      "MPI_Exscan");
+  } else {
+    CHECK_MPI_RET(
+      MPI_Scan(sendbuf, recvbuf, nelem, mpi_dtype, mpi_op,
+               team_data->comm),
+      "MPI_Scan");
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_scan(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+  DART_LOG_TRACE("dart_scan() team:%d nelem:%zu", team, nelem);
+  return dart__mpi__scan(sendbuf, recvbuf, nelem, dtype, op, team, false);
+}
+
+dart_ret_t dart_exscan(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+  DART_LOG_TRACE("dart_exscan() team:%d nelem:%zu", team, nelem);
+  return dart__mpi__scan(sendbuf, recvbuf, nelem, dtype, op, team, true);
+}
+
+dart_ret_t dart_reduce(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_unit_t    root,
+  dart_team_t         team)
+{
+  MPI_Comm     comm;
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_allreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_reduce ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  comm = team_data->comm;
+  CHECK_MPI_RET(
+    MPI_Reduce(
            sendbuf,
            recvbuf,
            nelem,
@@ -2299,6 +4098,454 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+/* -- Non-blocking collective operations -- */
+
+/**
+ * Allocate a handle for a non-blocking collective operation.
+ * Collectives are complete once their requests are, the handle thus never
+ * requires a flush.
+ */
+static inline
+dart_handle_t dart__mpi__coll_handle_alloc(void * tmpbuf)
+{
+  dart_handle_t handle = dart__mpi__handle_alloc();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_HANDLE_NULL;
+  }
+  handle->reqs[0]      = MPI_REQUEST_NULL;
+  handle->reqs[1]      = MPI_REQUEST_NULL;
+  handle->win          = MPI_WIN_NULL;
+  handle->dest         = DART_UNDEFINED_UNIT_ID;
+  handle->num_reqs     = 0;
+  handle->needs_flush  = false;
+  handle->tmpbuf       = tmpbuf;
+  return handle;
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t     teamid,
+  dart_handle_t * handleptr)
+{
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: Unknown team: %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(NULL);
+  CHECK_MPI_RET(
+    MPI_Ibarrier(team_data->comm, &handle->reqs[0]), "MPI_Ibarrier");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_DEBUG("dart_ibarrier > handle:%p", (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%zu",
+                 root.id, teamid, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  // chunk up the bcast if necessary, using at most two requests
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  if (dart__unlikely(nchunks > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: nelem (%zu) too large", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(NULL);
+
+  if (nchunks > 0) {
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, nchunks,
+                 dart__mpi__datatype_maxtype(dtype),
+                 root.id, comm, &handle->reqs[handle->num_reqs++]),
+      "MPI_Ibcast");
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype =
+      dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                 &handle->reqs[handle->num_reqs++]),
+      "MPI_Ibcast");
+  }
+
+  if (handle->num_reqs == 0) {
+    dart__mpi__handle_release(handle);
+    handle = DART_HANDLE_NULL;
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ibcast > root:%d team:%d nelem:%zu handle:%p",
+                 root.id, teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_TRACE("dart_iallgather() team:%d nelem:%zu", teamid, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_iallgather ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallgather ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallgather ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype =
+    dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(NULL);
+  CHECK_MPI_RET(
+    MPI_Iallgather(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        recvbuf,
+        nelem,
+        mpi_dtype,
+        team_data->comm,
+        &handle->reqs[0]),
+    "MPI_Iallgather");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_iallgather > team:%d nelem:%zu handle:%p",
+                 teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallgatherv(
+  const void      * sendbuf,
+  size_t            nsendelem,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_TRACE("dart_iallgatherv() team:%d nsendelem:%zu",
+                 teamid, nsendelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_iallgatherv ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nsendelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallgatherv ! failed: nsendelem (%zu) > INT_MAX",
+                   nsendelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallgatherv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  int comm_size = team_data->size;
+
+  // the converted counts have to outlive the call, they are released
+  // together with the handle
+  int *icounts = malloc(sizeof(int) * 2 * comm_size);
+  int *idispls = icounts + comm_size;
+  if (dart__mpi__counts_to_int(nrecvcounts, icounts, comm_size) != DART_OK ||
+      dart__mpi__counts_to_int(recvdispls,  idispls, comm_size) != DART_OK) {
+    DART_LOG_ERROR("dart_iallgatherv ! failed: invalid counts");
+    free(icounts);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Datatype mpi_dtype =
+    dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(icounts);
+  CHECK_MPI_RET(
+    MPI_Iallgatherv(
+        sendbuf,
+        nsendelem,
+        mpi_dtype,
+        recvbuf,
+        icounts,
+        idispls,
+        mpi_dtype,
+        team_data->comm,
+        &handle->reqs[0]),
+    "MPI_Iallgatherv");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_iallgatherv > team:%d nsendelem:%zu handle:%p",
+                 teamid, nsendelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handleptr)
+{
+  DART_LOG_TRACE("dart_iallreduce() team:%d nelem:%zu", team, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(NULL);
+  CHECK_MPI_RET(
+    MPI_Iallreduce(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           team_data->comm,
+           &handle->reqs[0]),
+    "MPI_Iallreduce");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_iallreduce > team:%d nelem:%zu handle:%p",
+                 team, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ialltoall(
+    const void *    sendbuf,
+    void *          recvbuf,
+    size_t          nelem,
+    dart_datatype_t dtype,
+    dart_team_t     teamid,
+    dart_handle_t * handleptr)
+{
+  DART_LOG_TRACE("dart_ialltoall() team:%d nelem:%zu", teamid, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ialltoall ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_ialltoall ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ialltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype =
+    dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(NULL);
+  CHECK_MPI_RET(
+      MPI_Ialltoall(
+          sendbuf,
+          nelem,
+          mpi_dtype,
+          recvbuf,
+          nelem,
+          mpi_dtype,
+          team_data->comm,
+          &handle->reqs[0]),
+      "MPI_Ialltoall");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ialltoall > team:%d nelem:%zu handle:%p",
+                 teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ialltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_TRACE("dart_ialltoallv() team:%d", teamid);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ialltoallv ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ialltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  int comm_size = team_data->size;
+
+  // the converted counts have to outlive the call, they are released
+  // together with the handle
+  int *isendcounts = malloc(sizeof(int) * 4 * comm_size);
+  int *isenddispls = isendcounts + comm_size;
+  int *irecvcounts = isenddispls + comm_size;
+  int *irecvdispls = irecvcounts + comm_size;
+  if (dart__mpi__counts_to_int(nsendelem,  isendcounts, comm_size)
+        != DART_OK ||
+      dart__mpi__counts_to_int(senddispls, isenddispls, comm_size)
+        != DART_OK ||
+      dart__mpi__counts_to_int(nrecvelem,  irecvcounts, comm_size)
+        != DART_OK ||
+      dart__mpi__counts_to_int(recvdispls, irecvdispls, comm_size)
+        != DART_OK) {
+    DART_LOG_ERROR("dart_ialltoallv ! failed: invalid counts");
+    free(isendcounts);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Datatype mpi_dtype =
+    dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(isendcounts);
+  CHECK_MPI_RET(
+      MPI_Ialltoallv(
+          sendbuf,
+          isendcounts,
+          isenddispls,
+          mpi_dtype,
+          recvbuf,
+          irecvcounts,
+          irecvdispls,
+          mpi_dtype,
+          team_data->comm,
+          &handle->reqs[0]),
+      "MPI_Ialltoallv");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ialltoallv > team:%d handle:%p",
+                 teamid, (void*)handle);
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t               nelem,
@@ -2341,6 +4588,60 @@ dart_ret_t dart_send(
   return DART_OK;
 }
 
+dart_ret_t dart_isend(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit,
+  dart_handle_t      * handleptr)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  dart_team_t team = DART_TEAM_ALL;
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_isend ! handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_isend ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_isend ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(unit, team_data);
+
+  // a send is complete once its request is, like a collective
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(NULL);
+  CHECK_MPI_RET(
+    MPI_Isend(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        unit.id,
+        tag,
+        team_data->comm,
+        &handle->reqs[0]),
+    "MPI_Isend");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_DEBUG("dart_isend > unit:%d tag:%d handle:%p",
+                 unit.id, tag, (void*)handle);
+  return DART_OK;
+}
+
 dart_ret_t dart_recv(
   void                * recvbuf,
   size_t                nelem,
@@ -2442,3 +4743,38 @@ dart_ret_t dart_sendrecv(
     "MPI_Sendrecv");
   return DART_OK;
 }
+
+dart_ret_t dart_probe(
+  int                  tag,
+  dart_global_unit_t * unit,
+  size_t             * nbytes,
+  int32_t            * flag)
+{
+  MPI_Status status;
+  int        mpi_flag;
+  int        count;
+  dart_team_t team = DART_TEAM_ALL;
+
+  if (dart__unlikely(unit == NULL || nbytes == NULL || flag == NULL)) {
+    DART_LOG_ERROR("dart_probe ! invalid argument");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_probe ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_MPI_RET(
+    MPI_Iprobe(MPI_ANY_SOURCE, tag, team_data->comm, &mpi_flag, &status),
+    "MPI_Iprobe");
+  *flag = mpi_flag;
+  if (mpi_flag) {
+    CHECK_MPI_RET(
+      MPI_Get_count(&status, MPI_BYTE, &count), "MPI_Get_count");
+    unit->id = status.MPI_SOURCE;
+    *nbytes  = count;
+  }
+  return DART_OK;
+}
@@ -18,6 +18,7 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_localpool.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
@@ -132,30 +133,32 @@ dart_ret_t dart_memalloc(
   dart_myid(&unitid);
   gptr->unitid  = unitid.id;
   gptr->flags   = 0;
-  gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
-  gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
-  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
-    DART_LOG_ERROR("dart_memalloc: Out of bounds "
-                   "(dart_buddy_alloc %zu bytes): global memory exhausted",
-                   nbytes);
+  /* The segment is DART_SEGMENT_LOCAL or DART_SEGMENT_LOCAL_EXT,
+   * depending on the pool chunk the memory is served from. */
+  if (dart__mpi__localpool_alloc(nbytes, gptr) != DART_OK) {
+    DART_LOG_ERROR("dart_memalloc: Failed to allocate %zu bytes: "
+                   "global memory exhausted", nbytes);
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
   }
-  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu offset:%"PRIu64"",
-                 nbytes, gptr->addr_or_offs.offset);
+  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu segid:%d "
+                 "offset:%"PRIu64"",
+                 nbytes, gptr->segid, gptr->addr_or_offs.offset);
   return DART_OK;
 }
 
 dart_ret_t dart_memfree (dart_gptr_t gptr)
 {
-  if (gptr.segid != DART_SEGMENT_LOCAL || gptr.teamid != DART_TEAM_ALL) {
+  if ((gptr.segid != DART_SEGMENT_LOCAL &&
+       gptr.segid != DART_SEGMENT_LOCAL_EXT) ||
+      gptr.teamid != DART_TEAM_ALL) {
     DART_LOG_ERROR("dart_memfree: invalid segment id:%d or team id:%d",
                    gptr.segid, gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  if (dart__mpi__localpool_free(gptr) != DART_OK) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
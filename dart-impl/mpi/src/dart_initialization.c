@@ -14,12 +14,16 @@
 
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_localpool.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_progress.h>
 
+/* Size of the memory reserved for local allocations, accessible through
+ * shared memory windows. Further memory is attached on demand. */
 #define DART_LOCAL_ALLOC_SIZE (1024UL*1024*16)
 
 /* Point to the base address of memory region for local allocation. */
@@ -29,7 +33,6 @@ static int _dart_initialized = 0;
 static
 dart_ret_t create_local_alloc(dart_team_data_t *team_data)
 {
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
   MPI_Win dart_sharedmem_win_local_alloc = MPI_WIN_NULL;
   char* *dart_sharedmem_local_baseptr_set = NULL;
 
@@ -134,11 +137,14 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   segment->disp        = calloc(team_data->size, sizeof(MPI_Aint));
   segment->is_dynamic       = false;
 
-  return DART_OK;
+  /* Serve local allocations from the reserved memory, further memory
+   * is attached on demand. */
+  return dart__mpi__localpool_init(
+           team_data, dart_mempool_localalloc, DART_LOCAL_ALLOC_SIZE);
 }
 
 static
-dart_ret_t do_init()
+dart_ret_t do_init(bool thread_multiple)
 {
   /* Initialize the teamlist. */
   dart_adapt_teamlist_init();
@@ -164,6 +170,10 @@ dart_ret_t do_init()
     return DART_ERR_OTHER;
   }
 
+  if (dart__mpi__handle_pool_init() != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
   dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
 
   /* Create a global translation table for all
@@ -177,6 +187,11 @@ dart_ret_t do_init()
   MPI_Comm_rank(team_data->comm, &team_data->unitid);
   MPI_Comm_size(team_data->comm, &team_data->size);
 
+  ret = dart_adapt_team_unit_tables_init(team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   ret = create_local_alloc(team_data);
   if (ret != DART_OK) {
     return ret;
@@ -206,6 +221,11 @@ dart_ret_t do_init()
 
   _dart_initialized = 2;
 
+  ret = dart__mpi__progress_init(thread_multiple);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_init > initialization finished");
   return DART_OK;
 }
@@ -232,7 +252,7 @@ dart_ret_t dart_init(
     MPI_Init(argc, argv);
   }
 
-  return do_init();
+  return do_init(false);
 }
 
 
@@ -276,7 +296,7 @@ dart_ret_t dart_init_thread(
   DART_LOG_DEBUG("dart_init_thread >> thread support enabled: %s",
             (*provided == DART_THREAD_MULTIPLE) ? "yes" : "no");
 
-  return do_init();
+  return do_init(*provided == DART_THREAD_MULTIPLE);
 }
 
 
@@ -289,6 +309,8 @@ dart_ret_t dart_exit()
   dart_global_unit_t unitid;
   dart_myid(&unitid);
 
+  dart__mpi__progress_fini();
+
   dart__mpi__locality_finalize();
 
   _dart_initialized = 0;
@@ -327,8 +349,9 @@ dart_ret_t dart_exit()
 #endif
   MPI_Win_free(&team_data->window);
 
+  dart__mpi__localpool_fini();
   dart_segment_fini(&team_data->segdata);
-  dart_buddy_delete(dart_localpool);
+  dart_adapt_team_unit_tables_fini(team_data);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 //  free(team_data->sharedmem_tab);
 //  free(dart_sharedmem_local_baseptr_set);
@@ -342,6 +365,8 @@ dart_ret_t dart_exit()
 
   dart__mpi__op_fini();
 
+  dart__mpi__handle_pool_fini();
+
   if (_init_by_dart) {
     DART_LOG_DEBUG("%2d: dart_exit: MPI_Finalize", unitid.id);
     MPI_Finalize();
@@ -0,0 +1,455 @@
+/**
+ * \file dart_localpool.c
+ *
+ * Growable pool for local allocations (\c dart_memalloc).
+ *
+ * The pool is made up of chunks, each managed by a buddy allocator.
+ * Chunk 0 is the memory reserved for local allocations at initialization,
+ * all further chunks are allocated once the existing chunks are exhausted
+ * and attached to a dynamic window that is shared by all units.
+ *
+ * Allocations of up to \c DART_LOCALPOOL_MAX_CLASS_SIZE bytes are rounded
+ * up to a power of two size class and served from slabs of
+ * \c DART_LOCALPOOL_SLAB_SIZE bytes. Free objects of a size class are
+ * kept in a per-thread cache and exchanged in batches with a central
+ * free list, so that the pool mutex is only taken once per batch.
+ * Slabs are never returned to the buddy allocator.
+ */
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+#include <dash/dart/base/atomic.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <dash/dart/mpi/dart_localpool.h>
+#include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <mpi.h>
+
+/* For PRIu64, uint64_t in printf */
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+
+#define DART_LOCALPOOL_SLAB_BITS       16
+#define DART_LOCALPOOL_SLAB_SIZE       (1UL << DART_LOCALPOOL_SLAB_BITS)
+#define DART_LOCALPOOL_MIN_CLASS_BITS  3
+#define DART_LOCALPOOL_NUM_CLASSES     8
+#define DART_LOCALPOOL_MAX_CLASS_SIZE \
+  (1UL << (DART_LOCALPOOL_MIN_CLASS_BITS + DART_LOCALPOOL_NUM_CLASSES - 1))
+/* number of objects moved between a thread cache and the central list */
+#define DART_LOCALPOOL_CACHE_BATCH     32
+#define DART_LOCALPOOL_MAX_CHUNKS      48
+
+typedef struct localpool_chunk {
+  char              * base;
+  size_t              size;
+  struct dart_buddy * buddy;
+  /* size class + 1 of each slab-sized region, 0 if not part of a slab */
+  uint8_t           * slab_class;
+} localpool_chunk_t;
+
+typedef struct localpool_object {
+  struct localpool_object * next;
+} localpool_object_t;
+
+typedef struct localpool_cache {
+  localpool_object_t * head[DART_LOCALPOOL_NUM_CLASSES];
+  int                  count[DART_LOCALPOOL_NUM_CLASSES];
+} localpool_cache_t;
+
+static struct {
+  localpool_chunk_t    chunks[DART_LOCALPOOL_MAX_CHUNKS];
+  /* only grows, read without holding the mutex */
+  int32_t              num_chunks;
+  /* protects the central free lists and adding chunks */
+  dart_mutex_t         mutex;
+  localpool_object_t * central[DART_LOCALPOOL_NUM_CLASSES];
+  MPI_Win              ext_win;
+#ifdef DART_HAVE_PTHREADS
+  pthread_key_t        cache_key;
+#endif
+} localpool;
+
+#ifndef DART_HAVE_PTHREADS
+static localpool_cache_t localpool_single_cache;
+#endif
+
+static inline int size_class(size_t nbytes)
+{
+  if (nbytes > DART_LOCALPOOL_MAX_CLASS_SIZE) {
+    return -1;
+  }
+  int cls = 0;
+  while ((1UL << (cls + DART_LOCALPOOL_MIN_CLASS_BITS)) < nbytes) {
+    ++cls;
+  }
+  return cls;
+}
+
+static inline size_t class_size(int cls)
+{
+  return 1UL << (cls + DART_LOCALPOOL_MIN_CLASS_BITS);
+}
+
+static inline size_t next_pow_of_2(size_t x)
+{
+  size_t res = 1;
+  while (res < x) {
+    res <<= 1;
+  }
+  return res;
+}
+
+/**
+ * Returns the chunk containing \c ptr or \c NULL.
+ */
+static localpool_chunk_t * find_chunk(const char * ptr)
+{
+  int num_chunks = DART_FETCH32(&localpool.num_chunks);
+  for (int i = 0; i < num_chunks; ++i) {
+    localpool_chunk_t *chunk = &localpool.chunks[i];
+    if (ptr >= chunk->base && ptr < chunk->base + chunk->size) {
+      return chunk;
+    }
+  }
+  return NULL;
+}
+
+static void cache_release(localpool_cache_t *cache)
+{
+  dart__base__mutex_lock(&localpool.mutex);
+  for (int cls = 0; cls < DART_LOCALPOOL_NUM_CLASSES; ++cls) {
+    localpool_object_t *obj = cache->head[cls];
+    while (obj != NULL) {
+      localpool_object_t *next = obj->next;
+      obj->next = localpool.central[cls];
+      localpool.central[cls] = obj;
+      obj = next;
+    }
+    cache->head[cls]  = NULL;
+    cache->count[cls] = 0;
+  }
+  dart__base__mutex_unlock(&localpool.mutex);
+}
+
+#ifdef DART_HAVE_PTHREADS
+static void cache_destroy(void *cache)
+{
+  cache_release((localpool_cache_t *)cache);
+  free(cache);
+}
+#endif
+
+static inline localpool_cache_t * get_cache()
+{
+#ifdef DART_HAVE_PTHREADS
+  localpool_cache_t *cache = pthread_getspecific(localpool.cache_key);
+  if (dart__unlikely(cache == NULL)) {
+    cache = calloc(1, sizeof(localpool_cache_t));
+    pthread_setspecific(localpool.cache_key, cache);
+  }
+  return cache;
+#else
+  return &localpool_single_cache;
+#endif
+}
+
+/**
+ * Allocate and attach a new chunk that can hold at least \c nbytes.
+ * Has to be called with the pool mutex held.
+ */
+static localpool_chunk_t * add_chunk(size_t nbytes)
+{
+  int num_chunks = localpool.num_chunks;
+  if (num_chunks == DART_LOCALPOOL_MAX_CHUNKS) {
+    DART_LOG_ERROR("dart_localpool: maximum number of chunks (%d) reached",
+                   DART_LOCALPOOL_MAX_CHUNKS);
+    return NULL;
+  }
+
+  // grow geometrically to keep the number of chunks small
+  size_t size = localpool.chunks[num_chunks - 1].size * 2;
+  if (size < nbytes) {
+    size = next_pow_of_2(nbytes);
+  }
+
+  localpool_chunk_t *chunk = &localpool.chunks[num_chunks];
+  if (MPI_Alloc_mem(size, MPI_INFO_NULL, &chunk->base) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_localpool: failed to allocate chunk of %zu bytes",
+                   size);
+    return NULL;
+  }
+  if (MPI_Win_attach(localpool.ext_win, chunk->base, size) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_localpool: failed to attach chunk of %zu bytes",
+                   size);
+    MPI_Free_mem(chunk->base);
+    return NULL;
+  }
+  chunk->size       = size;
+  chunk->buddy      = dart_buddy_new(size);
+  chunk->slab_class = calloc(size >> DART_LOCALPOOL_SLAB_BITS, 1);
+
+  // publish the chunk to find_chunk
+  DART_INC_AND_FETCH32(&localpool.num_chunks);
+
+  DART_LOG_DEBUG("dart_localpool: added chunk %d of %zu bytes at %p",
+                 num_chunks, size, chunk->base);
+  return chunk;
+}
+
+/**
+ * Allocate \c nbytes from any chunk, adding a chunk if required.
+ * Has to be called with the pool mutex held.
+ */
+static char * chunk_alloc(size_t nbytes, localpool_chunk_t ** chunk_out)
+{
+  for (int i = 0; i < localpool.num_chunks; ++i) {
+    localpool_chunk_t *chunk = &localpool.chunks[i];
+    if (nbytes > chunk->size) {
+      continue;
+    }
+    ssize_t offset = dart_buddy_alloc(chunk->buddy, nbytes);
+    if (offset >= 0) {
+      *chunk_out = chunk;
+      return chunk->base + offset;
+    }
+  }
+
+  localpool_chunk_t *chunk = add_chunk(nbytes);
+  if (chunk == NULL) {
+    return NULL;
+  }
+  ssize_t offset = dart_buddy_alloc(chunk->buddy, nbytes);
+  if (offset < 0) {
+    return NULL;
+  }
+  *chunk_out = chunk;
+  return chunk->base + offset;
+}
+
+/**
+ * Move up to a batch of objects of size class \c cls from the central
+ * list to \c cache, carving a new slab if the central list is empty.
+ */
+static dart_ret_t cache_refill(localpool_cache_t *cache, int cls)
+{
+  dart__base__mutex_lock(&localpool.mutex);
+
+  if (localpool.central[cls] == NULL) {
+    localpool_chunk_t *chunk;
+    char *slab = chunk_alloc(DART_LOCALPOOL_SLAB_SIZE, &chunk);
+    if (slab == NULL) {
+      dart__base__mutex_unlock(&localpool.mutex);
+      return DART_ERR_OTHER;
+    }
+    chunk->slab_class[(slab - chunk->base) >> DART_LOCALPOOL_SLAB_BITS] =
+      cls + 1;
+    size_t objsize = class_size(cls);
+    for (size_t offset = DART_LOCALPOOL_SLAB_SIZE; offset > 0;
+         offset -= objsize) {
+      localpool_object_t *obj =
+        (localpool_object_t *)(slab + offset - objsize);
+      obj->next = localpool.central[cls];
+      localpool.central[cls] = obj;
+    }
+  }
+
+  for (int i = 0;
+       i < DART_LOCALPOOL_CACHE_BATCH && localpool.central[cls] != NULL;
+       ++i) {
+    localpool_object_t *obj = localpool.central[cls];
+    localpool.central[cls] = obj->next;
+    obj->next = cache->head[cls];
+    cache->head[cls] = obj;
+    cache->count[cls]++;
+  }
+
+  dart__base__mutex_unlock(&localpool.mutex);
+  return DART_OK;
+}
+
+static void cache_flush(localpool_cache_t *cache, int cls)
+{
+  dart__base__mutex_lock(&localpool.mutex);
+  for (int i = 0; i < DART_LOCALPOOL_CACHE_BATCH; ++i) {
+    localpool_object_t *obj = cache->head[cls];
+    cache->head[cls] = obj->next;
+    obj->next = localpool.central[cls];
+    localpool.central[cls] = obj;
+  }
+  cache->count[cls] -= DART_LOCALPOOL_CACHE_BATCH;
+  dart__base__mutex_unlock(&localpool.mutex);
+}
+
+dart_ret_t
+dart__mpi__localpool_init(
+  dart_team_data_t * team_data,
+  char             * base,
+  size_t             size)
+{
+  memset(&localpool, 0, sizeof(localpool));
+  dart__base__mutex_init(&localpool.mutex);
+#ifdef DART_HAVE_PTHREADS
+  pthread_key_create(&localpool.cache_key, &cache_destroy);
+#else
+  memset(&localpool_single_cache, 0, sizeof(localpool_single_cache));
+#endif
+
+  localpool_chunk_t *chunk = &localpool.chunks[0];
+  chunk->base       = base;
+  chunk->size       = size;
+  chunk->buddy      = dart_buddy_new(size);
+  chunk->slab_class = calloc(size >> DART_LOCALPOOL_SLAB_BITS, 1);
+  if (chunk->buddy == NULL) {
+    return DART_ERR_OTHER;
+  }
+  localpool.num_chunks = 1;
+
+  /* Chunks added later are attached to a dynamic window, the offsets of
+   * allocations served from them are absolute addresses. */
+  MPI_Win_create_dynamic(MPI_INFO_NULL, DART_COMM_WORLD, &localpool.ext_win);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, localpool.ext_win);
+
+  dart_segment_info_t *segment = dart_segment_alloc(
+                         &team_data->segdata, DART_SEGMENT_LOCAL_EXT_ALLOC);
+  segment->flags       = 0;
+  segment->size        = 0;
+  segment->baseptr     = NULL;
+  segment->selfbaseptr = NULL;
+  segment->win         = localpool.ext_win;
+  segment->shmwin      = MPI_WIN_NULL;
+  segment->disp        = calloc(team_data->size, sizeof(MPI_Aint));
+  segment->is_dynamic  = true;
+
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__localpool_fini()
+{
+#ifdef DART_HAVE_PTHREADS
+  localpool_cache_t *cache = pthread_getspecific(localpool.cache_key);
+  pthread_key_delete(localpool.cache_key);
+  free(cache);
+#endif
+
+  for (int i = 0; i < localpool.num_chunks; ++i) {
+    localpool_chunk_t *chunk = &localpool.chunks[i];
+    if (i > 0) {
+      MPI_Win_detach(localpool.ext_win, chunk->base);
+      MPI_Free_mem(chunk->base);
+    }
+    dart_buddy_delete(chunk->buddy);
+    free(chunk->slab_class);
+  }
+  localpool.num_chunks = 0;
+
+  MPI_Win_unlock_all(localpool.ext_win);
+  MPI_Win_free(&localpool.ext_win);
+  dart__base__mutex_destroy(&localpool.mutex);
+
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__localpool_alloc(
+  size_t        nbytes,
+  dart_gptr_t * gptr)
+{
+  char *ptr;
+  int   cls = size_class(nbytes);
+
+  if (cls >= 0) {
+    localpool_cache_t *cache = get_cache();
+    if (cache->head[cls] == NULL &&
+        cache_refill(cache, cls) != DART_OK) {
+      return DART_ERR_OTHER;
+    }
+    localpool_object_t *obj = cache->head[cls];
+    cache->head[cls] = obj->next;
+    cache->count[cls]--;
+    ptr = (char *)obj;
+  } else {
+    localpool_chunk_t *chunk;
+    dart__base__mutex_lock(&localpool.mutex);
+    ptr = chunk_alloc(nbytes, &chunk);
+    dart__base__mutex_unlock(&localpool.mutex);
+    if (ptr == NULL) {
+      return DART_ERR_OTHER;
+    }
+  }
+
+  const localpool_chunk_t *chunk0 = &localpool.chunks[0];
+  if (ptr >= chunk0->base && ptr < chunk0->base + chunk0->size) {
+    gptr->segid               = DART_SEGMENT_LOCAL;
+    gptr->addr_or_offs.offset = ptr - chunk0->base;
+  } else {
+    gptr->segid               = DART_SEGMENT_LOCAL_EXT;
+    gptr->addr_or_offs.offset = (uint64_t)(uintptr_t)ptr;
+  }
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__localpool_free(
+  dart_gptr_t   gptr)
+{
+  char              *ptr;
+  localpool_chunk_t *chunk;
+
+  if (gptr.segid == DART_SEGMENT_LOCAL) {
+    chunk = &localpool.chunks[0];
+    if (gptr.addr_or_offs.offset >= chunk->size) {
+      return DART_ERR_INVAL;
+    }
+    ptr = chunk->base + gptr.addr_or_offs.offset;
+  } else if (gptr.segid == DART_SEGMENT_LOCAL_EXT) {
+    ptr   = (char *)(uintptr_t)gptr.addr_or_offs.offset;
+    chunk = find_chunk(ptr);
+    if (chunk == NULL) {
+      return DART_ERR_INVAL;
+    }
+  } else {
+    return DART_ERR_INVAL;
+  }
+
+  size_t offset = ptr - chunk->base;
+  int    cls    = chunk->slab_class[offset >> DART_LOCALPOOL_SLAB_BITS] - 1;
+  if (cls < 0) {
+    return (dart_buddy_free(chunk->buddy, offset) == 0)
+           ? DART_OK : DART_ERR_INVAL;
+  }
+
+  if ((offset & (class_size(cls) - 1)) != 0) {
+    return DART_ERR_INVAL;
+  }
+  localpool_cache_t  *cache = get_cache();
+  localpool_object_t *obj   = (localpool_object_t *)ptr;
+  obj->next = cache->head[cls];
+  cache->head[cls] = obj;
+  if (++cache->count[cls] > 2 * DART_LOCALPOOL_CACHE_BATCH) {
+    cache_flush(cache, cls);
+  }
+  return DART_OK;
+}
+
+MPI_Win
+dart__mpi__localpool_win(
+  dart_gptr_t   gptr)
+{
+  if (gptr.segid == DART_SEGMENT_LOCAL) {
+    return dart_win_local_alloc;
+  } else if (gptr.segid == DART_SEGMENT_LOCAL_EXT) {
+    return localpool.ext_win;
+  }
+  return MPI_WIN_NULL;
+}
@@ -37,7 +37,6 @@ struct dart_buddy {
 
 /* Help to do memory management work for local allocation/free */
 char* dart_mempool_localalloc;
-struct dart_buddy  *  dart_localpool;
 
 static inline unsigned int
 num_level(size_t size)
@@ -137,7 +136,7 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
   size_t length = 1 << self->level;
 
   if (size > length) {
-    DART_LOG_ERROR("Allocation size larger than total allocator size (%zu > %zu)",
+    DART_LOG_DEBUG("Allocation size larger than total allocator size (%zu > %zu)",
                    s, length<<DART_MEM_ALIGN_BITS);
     return -1;
   }
@@ -195,7 +194,7 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
   }
 
   dart__base__mutex_unlock(&self->mutex);
-  DART_LOG_ERROR(
+  DART_LOG_DEBUG(
     "Allocation larger than remaining available allocator memory (%zu)", s);
   return -1;
 }
@@ -172,6 +172,16 @@ dart_type_create_strided(
   new_struct->kind             = DART_KIND_STRIDED;
   new_struct->num_elem         = blocklen;
   new_struct->strided.stride   = stride;
+  new_struct->strided.cache_next = 0;
+  for (int i = 0; i < DART_MPI_STRIDED_CACHE_SIZE; ++i) {
+    new_struct->strided.cache[i].num_blocks = 0;
+    new_struct->strided.cache[i].mpi_type   = MPI_DATATYPE_NULL;
+  }
+  new_struct->strided.retired          = NULL;
+  new_struct->strided.num_retired      = 0;
+  new_struct->strided.retired_capacity = 0;
+  new_struct->strided.retired_next     = 0;
+  dart__base__mutex_init(&new_struct->strided.cache_mutex);
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -181,13 +191,12 @@ dart_type_create_strided(
 }
 
 
-MPI_Datatype
-dart__mpi__create_strided_mpi(
-  dart_datatype_t dart_type,
-  size_t          num_blocks)
+static MPI_Datatype
+create_strided_mpi(
+  dart_datatype_struct_t * dts,
+  size_t                   num_blocks)
 {
   MPI_Datatype new_mpi_dtype;
-  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
   MPI_Type_vector(
     num_blocks,             // the number of blocks
     dts->num_elem,          // the number of elements per block
@@ -198,10 +207,83 @@ dart__mpi__create_strided_mpi(
   return new_mpi_dtype;
 }
 
-void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
+/**
+ * Keep an MPI vector type evicted from the cache, another thread may have
+ * obtained it but not yet used it in an operation. Once the list of
+ * retired types is full, the oldest of them is freed instead.
+ */
+static void
+retire_strided_mpi(
+  dart_datatype_struct_t * dts,
+  MPI_Datatype             mpi_type)
 {
-  MPI_Type_free(mpi_type);
+  if (dts->strided.num_retired == dts->strided.retired_capacity &&
+      dts->strided.retired_capacity < DART_MPI_STRIDED_RETIRED_SIZE) {
+    size_t capacity = (dts->strided.retired_capacity == 0)
+                        ? DART_MPI_STRIDED_CACHE_SIZE
+                        : 2 * dts->strided.retired_capacity;
+    if (capacity > DART_MPI_STRIDED_RETIRED_SIZE) {
+      capacity = DART_MPI_STRIDED_RETIRED_SIZE;
+    }
+    MPI_Datatype *retired = realloc(
+                              dts->strided.retired,
+                              capacity * sizeof(MPI_Datatype));
+    if (retired != NULL) {
+      dts->strided.retired          = retired;
+      dts->strided.retired_capacity = capacity;
+    } else {
+      DART_LOG_WARN("Failed to grow list of retired MPI vector types of "
+                    "strided type %p", dts);
+    }
+  }
+
+  if (dts->strided.num_retired < dts->strided.retired_capacity) {
+    dts->strided.retired[dts->strided.num_retired++] = mpi_type;
+  } else if (dts->strided.retired_capacity > 0) {
+    MPI_Datatype *oldest = &dts->strided.retired[dts->strided.retired_next];
+    // MPI defers deallocation until pending operations have completed
+    MPI_Type_free(oldest);
+    *oldest = mpi_type;
+    dts->strided.retired_next =
+      (dts->strided.retired_next + 1) % dts->strided.retired_capacity;
+  } else {
+    MPI_Type_free(&mpi_type);
+  }
+}
+
+MPI_Datatype
+dart__mpi__strided_mpi_type(
+  dart_datatype_t dart_type,
+  size_t          num_blocks)
+{
+  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
+  MPI_Datatype mpi_type = MPI_DATATYPE_NULL;
+
+  dart__base__mutex_lock(&dts->strided.cache_mutex);
+  for (int i = 0; i < DART_MPI_STRIDED_CACHE_SIZE; ++i) {
+    if (dts->strided.cache[i].num_blocks == num_blocks) {
+      mpi_type = dts->strided.cache[i].mpi_type;
+      break;
+    }
+  }
+
+  if (mpi_type == MPI_DATATYPE_NULL) {
+    mpi_type = create_strided_mpi(dts, num_blocks);
+    dart_mpi_strided_cache_entry_t *entry =
+                                &dts->strided.cache[dts->strided.cache_next];
+    if (entry->num_blocks != 0) {
+      retire_strided_mpi(dts, entry->mpi_type);
+    }
+    entry->num_blocks = num_blocks;
+    entry->mpi_type   = mpi_type;
+    dts->strided.cache_next =
+                (dts->strided.cache_next + 1) % DART_MPI_STRIDED_CACHE_SIZE;
+    DART_LOG_TRACE("Cached MPI vector type with %zu blocks for strided "
+                   "type %p", num_blocks, dts);
+  }
+  dart__base__mutex_unlock(&dts->strided.cache_mutex);
+
+  return mpi_type;
 }
 
 dart_ret_t
@@ -234,6 +316,8 @@ dart_type_create_indexed(
   int *mpi_disps    = malloc(sizeof(int) * count);
 
   size_t num_elem = 0;
+  int    min_offs = (count > 0) ? INT_MAX : 0;
+  int    max_offs = 0;
   for (size_t i = 0; i < count; ++i) {
     if (blocklen[i] > INT_MAX) {
       DART_LOG_ERROR("dart_type_create_indexed: blocklen[%zu] > INT_MAX", i);
@@ -250,6 +334,12 @@ dart_type_create_indexed(
     mpi_blocklen[i] = blocklen[i];
     mpi_disps[i]    = offset[i];
     num_elem       += blocklen[i];
+    if (mpi_disps[i] < min_offs) {
+      min_offs = mpi_disps[i];
+    }
+    if (mpi_disps[i] + mpi_blocklen[i] > max_offs) {
+      max_offs = mpi_disps[i] + mpi_blocklen[i];
+    }
   }
 
   MPI_Datatype mpi_base_type = basetype_struct->contiguous.mpi_type;
@@ -273,6 +363,9 @@ dart_type_create_indexed(
   new_struct->indexed.blocklens  = mpi_blocklen;
   new_struct->indexed.offsets    = mpi_disps;
   new_struct->indexed.num_blocks = count;
+  // same as the extent of the MPI type, i.e., the distance between
+  // consecutive repetitions of the type
+  new_struct->indexed.extent     = max_offs - min_offs;
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -282,6 +375,104 @@ dart_type_create_indexed(
   return DART_OK;
 }
 
+/**
+ * Position in the block layout of a DART type, used to walk a sequence of
+ * \c nelem elements as contiguous blocks.
+ */
+typedef struct {
+  dart_datatype_struct_t * dts;
+  /// the index of the current block, including repetitions of the type
+  size_t                   block;
+  /// the element offset of the current block
+  size_t                   offset;
+  /// the number of elements left in the current block
+  size_t                   remaining;
+  /// the number of elements left in the whole sequence
+  size_t                   nelem;
+} dart_type_walk_t;
+
+static void
+type_walk_block(dart_type_walk_t *walk)
+{
+  dart_datatype_struct_t *dts = walk->dts;
+  size_t len;
+  switch (dts->kind) {
+    case DART_KIND_STRIDED:
+      walk->offset = walk->block * dts->strided.stride;
+      len          = dts->num_elem;
+      break;
+    case DART_KIND_INDEXED:
+    {
+      size_t rep   = walk->block / dts->indexed.num_blocks;
+      size_t idx   = walk->block % dts->indexed.num_blocks;
+      walk->offset = rep * dts->indexed.extent + dts->indexed.offsets[idx];
+      len          = dts->indexed.blocklens[idx];
+      break;
+    }
+    default:
+      // contiguous types consist of a single block
+      walk->offset = 0;
+      len          = walk->nelem;
+      break;
+  }
+  walk->remaining = (len < walk->nelem) ? len : walk->nelem;
+}
+
+static void
+type_walk_init(
+  dart_type_walk_t * walk,
+  dart_datatype_t    dart_type,
+  size_t             nelem)
+{
+  walk->dts   = dart__mpi__datatype_struct(dart_type);
+  walk->block = 0;
+  walk->nelem = nelem;
+  type_walk_block(walk);
+}
+
+static void
+type_walk_advance(dart_type_walk_t *walk, size_t nelem)
+{
+  walk->offset    += nelem;
+  walk->remaining -= nelem;
+  walk->nelem     -= nelem;
+  // skip to the next non-empty block
+  while (walk->remaining == 0 && walk->nelem > 0) {
+    ++walk->block;
+    type_walk_block(walk);
+  }
+}
+
+void
+dart__mpi__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem)
+{
+  dart_datatype_t elem_type = dart__mpi__datatype_iscontiguous(src_type)
+                                ? src_type
+                                : dart__mpi__datatype_struct(src_type)->base_type;
+  size_t elem_size = dart__mpi__datatype_sizeof(elem_type);
+  char       * dst_ptr = (char *)dst;
+  const char * src_ptr = (const char *)src;
+
+  dart_type_walk_t dst_walk, src_walk;
+  type_walk_init(&dst_walk, dst_type, nelem);
+  type_walk_init(&src_walk, src_type, nelem);
+
+  while (src_walk.nelem > 0) {
+    size_t len = (src_walk.remaining < dst_walk.remaining)
+                    ? src_walk.remaining : dst_walk.remaining;
+    memcpy(dst_ptr + dst_walk.offset * elem_size,
+           src_ptr + src_walk.offset * elem_size,
+           len * elem_size);
+    type_walk_advance(&dst_walk, len);
+    type_walk_advance(&src_walk, len);
+  }
+}
+
 dart_ret_t
 dart_type_create_custom(
   size_t            num_bytes,
@@ -341,6 +532,17 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
     free(dart_type->indexed.offsets);
     dart_type->indexed.offsets   = NULL;
     MPI_Type_free(&dart_type->indexed.mpi_type);
+  } else if (dart_type->kind == DART_KIND_STRIDED) {
+    for (int i = 0; i < DART_MPI_STRIDED_CACHE_SIZE; ++i) {
+      if (dart_type->strided.cache[i].num_blocks != 0) {
+        MPI_Type_free(&dart_type->strided.cache[i].mpi_type);
+      }
+    }
+    for (size_t i = 0; i < dart_type->strided.num_retired; ++i) {
+      MPI_Type_free(&dart_type->strided.retired[i]);
+    }
+    free(dart_type->strided.retired);
+    dart__base__mutex_destroy(&dart_type->strided.cache_mutex);
   } else if (dart_type->kind == DART_KIND_CUSTOM) {
     MPI_Type_free(&dart_type->contiguous.mpi_type);
     if (dart_type->contiguous.max_type != DART_MPI_TYPE_UNDEFINED) {
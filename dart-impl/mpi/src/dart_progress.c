@@ -0,0 +1,252 @@
+/**
+ * \file dart_progress.c
+ *
+ * Thread driving the progress of MPI communication while the units are
+ * busy computing. Without such a thread, passive-target RMA operations,
+ * lock hand-offs and non-blocking operations only progress inside MPI
+ * calls of the target unit unless the network provides hardware progress.
+ */
+#include <dash/dart/base/config.h>
+#ifdef DART__PLATFORM__LINUX
+/* _GNU_SOURCE required for pthread_setaffinity_np() */
+#  define _GNU_SOURCE
+#  include <sched.h>
+#endif
+
+#include <dash/dart/base/macro.h>
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/atomic.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_config.h>
+#include <dash/dart/if/dart_locality.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <dash/dart/mpi/dart_progress.h>
+
+#include <mpi.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef DART_HAVE_PTHREADS
+#  include <pthread.h>
+#endif
+
+#define DART_PROGRESS_THREAD_ENVSTR   "DART_PROGRESS_THREAD"
+#define DART_PROGRESS_CPU_ENVSTR      "DART_PROGRESS_CPU"
+#define DART_PROGRESS_INTERVAL_ENVSTR "DART_PROGRESS_INTERVAL"
+
+#ifdef DART_HAVE_PTHREADS
+
+static struct {
+  pthread_t thread;
+  int32_t   stop;
+  bool      active;
+  int       cpu;
+  int       interval_us;
+} progress;
+
+static void env_override(const char * envstr, int * value)
+{
+  const char * str = getenv(envstr);
+  if (str != NULL && *str != '\0') {
+    *value = atoi(str);
+  }
+}
+
+/**
+ * Rank of the calling unit among the units on the same host, derived from
+ * the locality information of units with lower ids.
+ */
+static int node_local_rank(
+  dart_global_unit_t           myid,
+  const dart_unit_locality_t * my_uloc)
+{
+  int rank = 0;
+  for (dart_unit_t u = 0; u < myid.id; ++u) {
+    dart_unit_locality_t * uloc;
+    if (dart_unit_locality(
+          DART_TEAM_ALL, DART_TEAM_UNIT_ID(u), &uloc) == DART_OK &&
+        strcmp(uloc->hwinfo.host, my_uloc->hwinfo.host) == 0) {
+      ++rank;
+    }
+  }
+  return rank;
+}
+
+/**
+ * Select the CPU the progress thread is pinned to, or -1 if there is no
+ * CPU other than the CPU of the unit itself.
+ *
+ * Units that are not bound to disjoint CPUs share the same set of allowed
+ * CPUs. The progress threads of the units on a node are therefore spread
+ * over the allowed CPUs from the last one downwards in the order of the
+ * node-local rank of the units.
+ */
+static int select_cpu()
+{
+#ifdef DART__PLATFORM__LINUX
+  dart_global_unit_t     myid;
+  dart_unit_locality_t * uloc;
+  int                    unit_cpu   = -1;
+  int                    local_rank = 0;
+
+  if (dart_myid(&myid) == DART_OK &&
+      dart_unit_locality(
+        DART_TEAM_ALL, DART_TEAM_UNIT_ID(myid.id), &uloc) == DART_OK) {
+    unit_cpu   = uloc->hwinfo.cpu_id;
+    local_rank = node_local_rank(myid, uloc);
+  }
+
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  if (sched_getaffinity(0, sizeof(cpuset), &cpuset) != 0) {
+    return -1;
+  }
+  int cpus[CPU_SETSIZE];
+  int num_cpus = 0;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpuset)) {
+      cpus[num_cpus++] = cpu;
+    }
+  }
+  if (num_cpus < 2) {
+    return -1;
+  }
+  int pos = num_cpus - 1 - (local_rank % num_cpus);
+  if (cpus[pos] == unit_cpu) {
+    // do not share the CPU with the unit itself
+    pos = (pos + num_cpus - 1) % num_cpus;
+  }
+  return cpus[pos];
+#else
+  return -1;
+#endif
+}
+
+static void * progress_thread_main(void * arg)
+{
+  dart__unused(arg);
+
+  struct timespec interval;
+  interval.tv_sec  = progress.interval_us / 1000000;
+  interval.tv_nsec = (progress.interval_us % 1000000) * 1000;
+
+  while (!DART_FETCH32(&progress.stop)) {
+    /* any MPI call on a communicator drives the progress engine */
+    int flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_SELF, &flag, MPI_STATUS_IGNORE);
+    if (progress.interval_us > 0) {
+      nanosleep(&interval, NULL);
+    } else {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+dart_ret_t dart__mpi__progress_init(bool thread_multiple)
+{
+  dart_config_t * config;
+  dart_config(&config);
+
+  int enabled          = config->progress_thread;
+  progress.cpu         = config->progress_cpu;
+  progress.interval_us = config->progress_interval_us;
+  env_override(DART_PROGRESS_THREAD_ENVSTR,   &enabled);
+  env_override(DART_PROGRESS_CPU_ENVSTR,      &progress.cpu);
+  env_override(DART_PROGRESS_INTERVAL_ENVSTR, &progress.interval_us);
+
+  if (!enabled) {
+    return DART_OK;
+  }
+  if (!thread_multiple) {
+    DART_LOG_WARN("dart__mpi__progress_init: progress thread requires "
+                  "dart_init_thread with support for DART_THREAD_MULTIPLE, "
+                  "not starting progress thread");
+    return DART_OK;
+  }
+  if (progress.interval_us < 0) {
+    progress.interval_us = 0;
+  }
+
+  progress.stop = 0;
+  if (pthread_create(
+        &progress.thread, NULL, &progress_thread_main, NULL) != 0) {
+    DART_LOG_ERROR("dart__mpi__progress_init: pthread_create failed");
+    return DART_ERR_OTHER;
+  }
+  progress.active = true;
+
+#ifdef DART__PLATFORM__LINUX
+  if (progress.cpu < 0) {
+    progress.cpu = select_cpu();
+  }
+  if (progress.cpu >= 0 && progress.cpu < CPU_SETSIZE) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(progress.cpu, &cpuset);
+    if (pthread_setaffinity_np(
+          progress.thread, sizeof(cpuset), &cpuset) != 0) {
+      DART_LOG_WARN("dart__mpi__progress_init: failed to pin progress "
+                    "thread to CPU %d", progress.cpu);
+    }
+  }
+#endif
+
+  DART_LOG_DEBUG("dart__mpi__progress_init: started progress thread "
+                 "(cpu:%d interval:%dus)",
+                 progress.cpu, progress.interval_us);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__progress_fini()
+{
+  if (!progress.active) {
+    return DART_OK;
+  }
+  DART_FETCH_AND_INC32(&progress.stop);
+  if (pthread_join(progress.thread, NULL) != 0) {
+    DART_LOG_ERROR("dart__mpi__progress_fini: pthread_join failed");
+    return DART_ERR_OTHER;
+  }
+  progress.active = false;
+  DART_LOG_DEBUG("dart__mpi__progress_fini: stopped progress thread");
+  return DART_OK;
+}
+
+bool dart__mpi__progress_active()
+{
+  return progress.active;
+}
+
+#else /* DART_HAVE_PTHREADS */
+
+dart_ret_t dart__mpi__progress_init(bool thread_multiple)
+{
+  dart__unused(thread_multiple);
+  dart_config_t * config;
+  dart_config(&config);
+  const char * env = getenv(DART_PROGRESS_THREAD_ENVSTR);
+  if (config->progress_thread || (env != NULL && atoi(env))) {
+    DART_LOG_WARN("dart__mpi__progress_init: progress thread requires "
+                  "pthreads, not starting progress thread");
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__progress_fini()
+{
+  return DART_OK;
+}
+
+bool dart__mpi__progress_active()
+{
+  return false;
+}
+
+#endif /* DART_HAVE_PTHREADS */
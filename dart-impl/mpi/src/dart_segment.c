@@ -10,53 +10,62 @@
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
+struct dart_segment_elem {
+  dart_segment_elem_t *next;
   dart_segment_info_t  data;
 };
 
 
-static inline int hash_segid(dart_segid_t segid)
+/**
+ * Returns the table slot of the segment with ID \c segid.
+ * If \c create is set, the block containing the slot is allocated if
+ * required, otherwise \c NULL is returned for an unallocated block.
+ */
+static inline dart_segment_elem_t ** segment_slot(
+    dart_segmentdata_t *segdata,
+    dart_segid_t        segid,
+    bool                create)
 {
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
+  dart_segment_elem_t ***blocks;
+  int idx;
+  if (segid >= 0) {
+    blocks = segdata->mem_blocks;
+    idx    = segid;
+  } else {
+    blocks = segdata->reg_blocks;
+    idx    = -(segid + 1);
+  }
+  dart_segment_elem_t **block = blocks[idx >> DART_SEGMENT_BLOCK_BITS];
+  if (block == NULL) {
+    if (!create) {
+      return NULL;
+    }
+    block = calloc(DART_SEGMENT_BLOCK_SIZE, sizeof(dart_segment_elem_t *));
+    blocks[idx >> DART_SEGMENT_BLOCK_BITS] = block;
+  }
+  return &block[idx & (DART_SEGMENT_BLOCK_SIZE - 1)];
 }
 
 static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
+register_segment(dart_segmentdata_t *segdata, dart_segment_elem_t *elem)
 {
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
+  *segment_slot(segdata, elem->data.segid, true) = elem;
 }
 
 static dart_segment_info_t * get_segment(
     dart_segmentdata_t *segdata,
     dart_segid_t        segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
+  dart_segment_elem_t **slot = segment_slot(segdata, segid, false);
 
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
-    }
-    elem = elem->next;
-  }
-
-  if (elem == NULL) {
+  if (slot == NULL || *slot == NULL) {
     DART_LOG_ERROR("dart_segment__get_segment : "
                    "Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
     return NULL;
   }
 
-  return &(elem->data);
+  return &((*slot)->data);
 }
 
 dart_segment_info_t * dart_segment_get_info(
@@ -67,12 +76,12 @@ dart_segment_info_t * dart_segment_get_info(
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment data table.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  memset(segdata->mem_blocks, 0, sizeof(segdata->mem_blocks));
+  memset(segdata->reg_blocks, 0, sizeof(segdata->reg_blocks));
 
   segdata->team_id = teamid;
   segdata->mem_freelist = NULL;
@@ -95,11 +104,15 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid = INT16_MAX;
-  dart_seghash_elem_t *elem = NULL;
+  dart_segment_elem_t *elem = NULL;
   if (type == DART_SEGMENT_LOCAL_ALLOC) {
     // no need to check for overflow
     segid = DART_SEGMENT_LOCAL;
-    elem = calloc(1, sizeof(dart_seghash_elem_t));
+    elem = calloc(1, sizeof(dart_segment_elem_t));
+    elem->data.segid = segid;
+  } else if (type == DART_SEGMENT_LOCAL_EXT_ALLOC) {
+    segid = DART_SEGMENT_LOCAL_EXT;
+    elem = calloc(1, sizeof(dart_segment_elem_t));
     elem->data.segid = segid;
   } else if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
@@ -114,7 +127,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
@@ -131,7 +144,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else {
@@ -297,50 +310,36 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
-
-    pred = elem;
-    elem = elem->next;
+  dart_segment_elem_t **slot = segment_slot(segdata, segid, false);
+  if (slot == NULL || *slot == NULL) {
+    // element not found
+    return DART_ERR_INVAL;
   }
 
-  // element not found
-  return DART_ERR_INVAL;
+  dart_segment_elem_t *elem = *slot;
+  *slot = NULL;
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  if (segid > 0) {
+    elem->next            = segdata->mem_freelist;
+    segdata->mem_freelist = elem;
+  } else if (segid < 0){
+    elem->next            = segdata->reg_freelist;
+    segdata->reg_freelist = elem;
+  } else {
+    // This should not happen!
+    DART_ASSERT(segid != 0);
+  }
+  // set the segment ID again
+  elem->data.segid = segid;
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void clear_segdata_list(dart_segment_elem_t *listhead)
 {
-  dart_seghash_elem_t *elem = listhead;
+  dart_segment_elem_t *elem = listhead;
   while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
+    dart_segment_elem_t *tmp = elem;
     elem = tmp->next;
     tmp->next = NULL;
     // segment info should have been cleared in dart_segment_fini
@@ -351,8 +350,27 @@ static void clear_segdata_list(dart_seghash_elem_t *listhead)
   }
 }
 
+static void clear_segdata_blocks(
+  dart_segment_elem_t ** blocks[DART_SEGMENT_NUM_BLOCKS])
+{
+  for (int i = 0; i < DART_SEGMENT_NUM_BLOCKS; i++) {
+    if (blocks[i] == NULL) {
+      continue;
+    }
+    for (int j = 0; j < DART_SEGMENT_BLOCK_SIZE; j++) {
+      // segments in the table are not linked to each other
+      if (blocks[i][j] != NULL) {
+        blocks[i][j]->next = NULL;
+        clear_segdata_list(blocks[i][j]);
+      }
+    }
+    free(blocks[i]);
+    blocks[i] = NULL;
+  }
+}
+
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment data table.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
@@ -365,11 +383,9 @@ dart_ret_t dart_segment_fini(
     free_segment_info(seg);
   }
 
-  // clear the remaining hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
-  }
+  // clear the remaining table
+  clear_segdata_blocks(segdata->mem_blocks);
+  clear_segdata_blocks(segdata->reg_blocks);
   clear_segdata_list(segdata->mem_freelist);
   segdata->mem_freelist = NULL;
 
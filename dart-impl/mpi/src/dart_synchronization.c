@@ -16,6 +16,7 @@
 
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_localpool.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_synchronization_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
@@ -38,6 +39,24 @@ struct dart_lock_struct
    * to which we send a release message.
    */
   dart_gptr_t  gptr_list;
+  /**
+   * Window used to access \c gptr_tail.
+   */
+  MPI_Win      win_tail;
+  /**
+   * Displacement of \c gptr_tail in \c win_tail.
+   */
+  MPI_Aint     disp_tail;
+  /**
+   * Number of locks sharing the memory of this lock if it owns the
+   * memory, 0 for the other locks of a lock array.
+   */
+  size_t       num_locks;
+  /**
+   * Whether this lock is an element of a lock array allocated by
+   * \ref dart_team_lock_array_init.
+   */
+  bool         is_array;
   /**
    * Pointer to the next element a the list.
    */
@@ -85,7 +104,7 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
     /* Local store is safe and effective followed by the sync call. */
     *tail_ptr = -1;
-    MPI_Win_sync(dart_win_local_alloc);
+    MPI_Win_sync(dart__mpi__localpool_win(gptr_tail));
   }
 
   /* Create a global memory region across the team.
@@ -123,6 +142,10 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   *lock = malloc(sizeof(struct dart_lock_struct));
   (*lock)->gptr_tail   = gptr_tail;
   (*lock)->gptr_list   = gptr_list;
+  (*lock)->win_tail    = dart__mpi__localpool_win(gptr_tail);
+  (*lock)->disp_tail   = gptr_tail.addr_or_offs.offset;
+  (*lock)->num_locks   = 1;
+  (*lock)->is_array    = false;
   (*lock)->teamid      = teamid;
   (*lock)->is_acquired = 0;
   DART_ASSERT_RETURNS(
@@ -138,6 +161,150 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   return DART_OK;
 }
 
+dart_ret_t dart_team_lock_array_init(
+  dart_team_t   teamid,
+  size_t        num_locks,
+  dart_lock_t * locks)
+{
+  dart_ret_t       ret;
+  dart_gptr_t      gptr;
+  dart_team_unit_t unitid;
+
+  if (locks == NULL || num_locks == 0 || num_locks > INT32_MAX) {
+    DART_LOG_ERROR("dart_team_lock_array_init ! invalid arguments");
+    return DART_ERR_INVAL;
+  }
+
+  for (size_t i = 0; i < num_locks; ++i) {
+    locks[i] = DART_LOCK_NULL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_myid(teamid, &unitid);
+
+  /*
+   * All locks share a single segment. Every unit holds the next pointers
+   * of all locks in its waiting lists, followed by the tails of the locks
+   * it hosts. Lock i is hosted by unit i % size to spread the atomic
+   * operations on the tails across the team.
+   */
+  size_t num_tails = (num_locks + team_data->size - 1) / team_data->size;
+  ret = dart_team_memalloc_aligned(
+          teamid, num_locks + num_tails, DART_TYPE_INT, &gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __func__);
+    return ret;
+  }
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), gptr.segid);
+  int32_t *baseptr;
+  dart_gptr_setunit(&gptr, unitid);
+  dart_gptr_getaddr(gptr, (void*)&baseptr);
+  for (size_t i = 0; i < num_locks + num_tails; ++i) {
+    baseptr[i] = -1;
+  }
+  MPI_Win_sync(seginfo->win);
+
+  struct dart_lock_struct *array =
+    malloc(num_locks * sizeof(struct dart_lock_struct));
+  if (array == NULL) {
+    dart_team_memfree(gptr);
+    return DART_ERR_OTHER;
+  }
+
+  for (size_t i = 0; i < num_locks; ++i) {
+    struct dart_lock_struct *lock = &array[i];
+    dart_team_unit_t tail_unit =
+      DART_TEAM_UNIT_ID(i % team_data->size);
+    uint64_t tail_offset =
+      (num_locks + (i / team_data->size)) * sizeof(int32_t);
+
+    lock->gptr_list = gptr;
+    lock->gptr_list.addr_or_offs.offset = i * sizeof(int32_t);
+    lock->gptr_tail = gptr;
+    lock->gptr_tail.addr_or_offs.offset = tail_offset;
+    dart_gptr_setunit(&lock->gptr_tail, tail_unit);
+    lock->win_tail    = seginfo->win;
+    lock->disp_tail   = dart_segment_disp(seginfo, tail_unit) + tail_offset;
+    lock->num_locks   = (i == 0) ? num_locks : 0;
+    lock->is_array    = true;
+    lock->teamid      = teamid;
+    lock->is_acquired = 0;
+    lock->next        = NULL;
+    DART_ASSERT_RETURNS(
+      dart__base__mutex_init_recursive(&lock->mutex),
+      DART_OK);
+    locks[i] = lock;
+  }
+
+  // only the first lock owns the memory and is registered with the team
+  array->next = team_data->allocated_locks;
+  team_data->allocated_locks = array;
+
+  // no unit may access the locks before all of them are initialized
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize lock initialization!",
+                   __func__);
+    return ret;
+  }
+
+  DART_LOG_DEBUG("dart_team_lock_array_init: %zu locks in team %d",
+                 num_locks, teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_team_lock_array_destroy(
+  size_t        num_locks,
+  dart_lock_t * locks)
+{
+  if (locks == NULL || num_locks == 0 || locks[0] == DART_LOCK_NULL) {
+    return DART_OK;
+  }
+
+  struct dart_lock_struct *array = locks[0];
+  if (!array->is_array || array->num_locks != num_locks) {
+    DART_LOG_ERROR("dart_team_lock_array_destroy ! "
+                   "expected the %zu locks of a lock array", num_locks);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_t teamid = array->teamid;
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+
+  if (team_data != NULL) {
+    // if the team is still alive the lock segment has not been free'd
+    struct dart_lock_struct *prev = NULL, *elem = team_data->allocated_locks;
+    while (elem != NULL && elem != array) {
+      prev = elem;
+      elem = elem->next;
+    }
+    DART_ASSERT_MSG(elem != NULL, "Unknown lock array!");
+
+    if (prev == NULL) {
+      team_data->allocated_locks = elem->next;
+    } else {
+      prev->next = elem->next;
+    }
+
+    destroy_lock_segments(array);
+  }
+
+  for (size_t i = 0; i < num_locks; ++i) {
+    array[i].teamid = DART_TEAM_NULL;
+    dart__base__mutex_destroy(&array[i].mutex);
+    locks[i] = DART_LOCK_NULL;
+  }
+  free(array);
+  DART_LOG_DEBUG("dart_team_lock_array_destroy: done in team %d", teamid);
+  return DART_OK;
+}
+
 dart_ret_t dart_lock_acquire(dart_lock_t lock)
 {
   /* lock the local mutex and keep it until the global lock is released */
@@ -161,7 +328,7 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
   dart_gptr_t gptr_tail = lock->gptr_tail;
   dart_gptr_t gptr_list = lock->gptr_list;
 
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
+  MPI_Aint    tail_offset = lock->disp_tail;
   dart_unit_t tail_unit   = gptr_tail.unitid;
 
   dart_team_unit_t unitid;
@@ -173,7 +340,7 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
   DART_LOG_TRACE(
     "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
     "tail_unit %i with offset %lu",
-    unitid.id, tail_unit, tail_offset);
+    unitid.id, tail_unit, (unsigned long)tail_offset);
   DART_ASSERT_RETURNS(
     MPI_Fetch_and_op(
       &unitid.id,
@@ -182,10 +349,10 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
       tail_unit,
       tail_offset,
       MPI_REPLACE,
-      dart_win_local_alloc),
+      lock->win_tail),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-      MPI_Win_flush(tail_unit, dart_win_local_alloc),
+      MPI_Win_flush(tail_unit, lock->win_tail),
       MPI_SUCCESS);
 
   DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
@@ -202,7 +369,8 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
                                       &(team_data->segdata), gptr_list.segid);
     MPI_Win  win = list_seginfo->win;
     MPI_Aint disp_list = dart_segment_disp(
-                            list_seginfo, DART_TEAM_UNIT_ID(predecessor));
+                            list_seginfo, DART_TEAM_UNIT_ID(predecessor))
+                         + gptr_list.addr_or_offs.offset;
 
     /* Atomicity: Update its predecessor's next pointer */
     DART_ASSERT_RETURNS(
@@ -260,7 +428,7 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
 
   dart_gptr_t gptr_tail   = lock->gptr_tail;
   dart_unit_t tail_unit   = gptr_tail.unitid;
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
+  MPI_Aint    tail_offset = lock->disp_tail;
 
   /* Atomicity: Check if the lock is available and claim it if it is. */
   DART_ASSERT_RETURNS(
@@ -271,10 +439,10 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
       MPI_INT32_T,
       tail_unit,
       tail_offset,
-      dart_win_local_alloc),
+      lock->win_tail),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-    MPI_Win_flush (tail_unit, dart_win_local_alloc),
+    MPI_Win_flush(tail_unit, lock->win_tail),
     MPI_SUCCESS);
 
   /* If the old predecessor was -1, we have claimed the lock,
@@ -308,7 +476,7 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
 
-  uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
+  MPI_Aint      offset_tail = lock->disp_tail;
   dart_unit_t   tail        = gptr_tail.unitid;
   int32_t     * addr;
   DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
@@ -330,10 +498,10 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
       MPI_INT32_T,
       tail,
       offset_tail,
-      dart_win_local_alloc),
+      lock->win_tail),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-    MPI_Win_flush(tail, dart_win_local_alloc),
+    MPI_Win_flush(tail, lock->win_tail),
     MPI_SUCCESS);
 
   if (result != unitid.id) {
@@ -346,7 +514,8 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     dart_segment_info_t *list_seginfo = dart_segment_get_info(
                                       &(team_data->segdata), gptr_list.segid);
     MPI_Win win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(list_seginfo, unitid);
+    MPI_Aint disp_list = dart_segment_disp(list_seginfo, unitid)
+                         + gptr_list.addr_or_offs.offset;
 
     /* Wait for the update of our next pointer. */
     do {
@@ -391,6 +560,12 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
     return DART_OK;
   }
 
+  if ((*lock)->is_array) {
+    DART_LOG_ERROR("dart_team_lock_destroy ! "
+                   "locks of a lock array cannot be destroyed individually");
+    return DART_ERR_INVAL;
+  }
+
   dart_team_t teamid = (*lock)->teamid;
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
@@ -456,8 +631,23 @@ dart_ret_t destroy_lock_segments(dart_lock_t lock)
 
   dart_team_myid(teamid, &unitid);
 
-  /* Unit 0 is the process holding the gptr_tail by default. */
-  if (unitid.id == 0) {
+  /* Free the list first: dart_team_memfree is collective, so no other
+   * unit accesses the tail anymore once it returned. */
+  if (!DART_GPTR_ISNULL(gptr_list)) {
+    ret = dart_team_memfree(gptr_list);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("Failed to free global mmeory");
+      return ret;
+    }
+    lock->gptr_list = DART_GPTR_NULL;
+    if (lock->is_array) {
+      lock->gptr_tail = DART_GPTR_NULL;
+    }
+  }
+
+  /* Unit 0 is the process holding the gptr_tail of single locks, the
+   * tails of lock arrays are part of the list segment. */
+  if (unitid.id == 0 && !lock->is_array) {
     if (!DART_GPTR_ISNULL(gptr_tail)) {
       ret = dart_memfree(gptr_tail);
       if (ret != DART_OK) {
@@ -467,14 +657,429 @@ dart_ret_t destroy_lock_segments(dart_lock_t lock)
       lock->gptr_tail = DART_GPTR_NULL;
     }
   }
-  if (!DART_GPTR_ISNULL(gptr_list)) {
-    ret = dart_team_memfree(gptr_list);
+  return DART_OK;
+}
+
+
+/* -- Reader-writer locks -- */
+
+/*
+ * Every unit holds the following slots of a reader-writer lock, the state
+ * and the tail of the writer queue are only used on the host unit 0:
+ */
+enum {
+  /** Number of readers, plus DART_RWLOCK_WRITER if a writer is present */
+  DART_RWLOCK_SLOT_STATE = 0,
+  /** Last unit in the writer queue, -1 if the queue is empty */
+  DART_RWLOCK_SLOT_TAIL,
+  /** Successor of this unit in the writer queue */
+  DART_RWLOCK_SLOT_NEXT,
+  /** Set by the predecessor in the writer queue to hand over the lock */
+  DART_RWLOCK_SLOT_FLAG,
+  /** Incremented by every writer on release to wake up waiting readers */
+  DART_RWLOCK_SLOT_GEN,
+  DART_RWLOCK_NUM_SLOTS
+};
+
+#define DART_RWLOCK_WRITER ((int32_t)1 << 30)
+
+#define DART_RWLOCK_HOST   0
+
+struct dart_rwlock_struct
+{
+  /** Global memory holding the slots of all units */
+  dart_gptr_t      gptr;
+  dart_team_t      teamid;
+  dart_team_unit_t myid;
+  /**
+   * Local mutex to ensure mutual exclusion between writing threads,
+   * held while the lock is acquired for writing.
+   */
+  dart_mutex_t     mutex;
+  /** Whether this unit has acquired the lock for writing. */
+  int32_t          is_acquired;
+};
+
+static inline
+MPI_Aint rwlock_disp(
+  const dart_segment_info_t * seginfo,
+  dart_team_unit_t            unit,
+  int                         slot)
+{
+  return dart_segment_disp(seginfo, unit) + slot * sizeof(int32_t);
+}
+
+/**
+ * Atomically apply \c op with \c value to \c slot at \c unit and return
+ * the previous value.
+ */
+static
+int32_t rwlock_fetch_op(
+  dart_rwlock_t    lock,
+  dart_team_unit_t unit,
+  int              slot,
+  int32_t          value,
+  MPI_Op           op)
+{
+  int32_t result;
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), lock->gptr.segid);
+  DART_ASSERT(seginfo != NULL);
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value,
+      &result,
+      MPI_INT32_T,
+      unit.id,
+      rwlock_disp(seginfo, unit, slot),
+      op,
+      seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit.id, seginfo->win),
+    MPI_SUCCESS);
+  return result;
+}
+
+static inline
+int32_t rwlock_fetch(
+  dart_rwlock_t    lock,
+  dart_team_unit_t unit,
+  int              slot)
+{
+  return rwlock_fetch_op(lock, unit, slot, 0, MPI_NO_OP);
+}
+
+/**
+ * Spin on the local \c slot until its value differs from \c value.
+ */
+static
+int32_t rwlock_wait_local(
+  dart_rwlock_t lock,
+  int           slot,
+  int32_t       value)
+{
+  int32_t current;
+  while ((current = rwlock_fetch(lock, lock->myid, slot)) == value) { }
+  return current;
+}
+
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid, dart_rwlock_t *lock)
+{
+  dart_ret_t  ret;
+  dart_gptr_t gptr;
+
+  *lock = DART_RWLOCK_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  ret = dart_team_memalloc_aligned(
+          teamid, DART_RWLOCK_NUM_SLOTS, DART_TYPE_INT, &gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __func__);
+    return ret;
+  }
+
+  dart_team_unit_t unitid;
+  dart_team_myid(teamid, &unitid);
+
+  int32_t *slots;
+  dart_gptr_t gptr_local = gptr;
+  dart_gptr_setunit(&gptr_local, unitid);
+  dart_gptr_getaddr(gptr_local, (void*)&slots);
+  slots[DART_RWLOCK_SLOT_STATE] = 0;
+  slots[DART_RWLOCK_SLOT_TAIL]  = -1;
+  slots[DART_RWLOCK_SLOT_NEXT]  = -1;
+  slots[DART_RWLOCK_SLOT_FLAG]  = 0;
+  slots[DART_RWLOCK_SLOT_GEN]   = 0;
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), gptr.segid);
+  MPI_Win_sync(seginfo->win);
+
+  struct dart_rwlock_struct *res = malloc(sizeof(struct dart_rwlock_struct));
+  res->gptr        = gptr;
+  res->teamid      = teamid;
+  res->myid        = unitid;
+  res->is_acquired = 0;
+  DART_ASSERT_RETURNS(
+    dart__base__mutex_init(&res->mutex),
+    DART_OK);
+
+  // no unit may access the lock before all slots are initialized
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize lock initialization!",
+                   __func__);
+    return ret;
+  }
+
+  *lock = res;
+  DART_LOG_DEBUG("dart_team_rwlock_init: done in team %d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_team_rwlock_destroy(dart_rwlock_t *lock)
+{
+  if (!lock || DART_RWLOCK_NULL == *lock) {
+    return DART_OK;
+  }
+
+  dart_rwlock_t rwlock = *lock;
+  dart_team_t   teamid = rwlock->teamid;
+
+  // the segment is gone with the team
+  if (dart_adapt_teamlist_get(teamid) != NULL) {
+    dart_ret_t ret = dart_team_memfree(rwlock->gptr);
     if (ret != DART_OK) {
-      DART_LOG_ERROR("Failed to free global mmeory");
+      DART_LOG_ERROR("Failed to free global memory");
       return ret;
     }
-    lock->gptr_list = DART_GPTR_NULL;
   }
 
+  dart__base__mutex_destroy(&rwlock->mutex);
+  free(rwlock);
+  *lock = DART_RWLOCK_NULL;
+  DART_LOG_DEBUG("dart_team_rwlock_destroy: done in team %d", teamid);
+  return DART_OK;
+}
+
+/**
+ * Enqueue in the writer queue and wait for the predecessor to hand over.
+ * If \c try_only is set, only enter an empty queue.
+ */
+static
+bool rwlock_enqueue_writer(dart_rwlock_t lock, bool try_only)
+{
+  dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+  int32_t myid = lock->myid.id;
+
+  // reset the queue entry before anybody can see it
+  rwlock_fetch_op(lock, lock->myid, DART_RWLOCK_SLOT_NEXT, -1, MPI_REPLACE);
+  rwlock_fetch_op(lock, lock->myid, DART_RWLOCK_SLOT_FLAG,  0, MPI_REPLACE);
+
+  int32_t predecessor;
+  if (try_only) {
+    int32_t compare = -1;
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+    dart_segment_info_t *seginfo = dart_segment_get_info(
+                                     &(team_data->segdata), lock->gptr.segid);
+    DART_ASSERT_RETURNS(
+      MPI_Compare_and_swap(
+        &myid,
+        &compare,
+        &predecessor,
+        MPI_INT32_T,
+        host.id,
+        rwlock_disp(seginfo, host, DART_RWLOCK_SLOT_TAIL),
+        seginfo->win),
+      MPI_SUCCESS);
+    DART_ASSERT_RETURNS(
+      MPI_Win_flush(host.id, seginfo->win),
+      MPI_SUCCESS);
+    return (predecessor == -1);
+  }
+
+  predecessor = rwlock_fetch_op(
+                  lock, host, DART_RWLOCK_SLOT_TAIL, myid, MPI_REPLACE);
+  if (predecessor != -1) {
+    // link into the queue and spin locally until the predecessor is done
+    rwlock_fetch_op(
+      lock, DART_TEAM_UNIT_ID(predecessor), DART_RWLOCK_SLOT_NEXT,
+      myid, MPI_REPLACE);
+    DART_LOG_DEBUG("dart_rwlock_acquire: waiting for writer %d",
+                   predecessor);
+    rwlock_wait_local(lock, DART_RWLOCK_SLOT_FLAG, 0);
+  }
+  return true;
+}
+
+/**
+ * Hand the writer queue over to the successor, if any.
+ */
+static
+void rwlock_dequeue_writer(dart_rwlock_t lock)
+{
+  dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+  int32_t myid  = lock->myid.id;
+  int32_t reset = -1;
+  int32_t result;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), lock->gptr.segid);
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &reset,
+      &myid,
+      &result,
+      MPI_INT32_T,
+      host.id,
+      rwlock_disp(seginfo, host, DART_RWLOCK_SLOT_TAIL),
+      seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(host.id, seginfo->win),
+    MPI_SUCCESS);
+
+  if (result != myid) {
+    // a successor is enqueueing, wait until it linked itself
+    int32_t next = rwlock_wait_local(lock, DART_RWLOCK_SLOT_NEXT, -1);
+    DART_LOG_DEBUG("dart_rwlock_release: handing over to writer %d",
+                   next);
+    rwlock_fetch_op(
+      lock, DART_TEAM_UNIT_ID(next), DART_RWLOCK_SLOT_FLAG, 1, MPI_REPLACE);
+  }
+}
+
+/**
+ * Withdraw the writer flag and wake up all readers waiting for it.
+ */
+static
+void rwlock_clear_writer(dart_rwlock_t lock)
+{
+  dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+  rwlock_fetch_op(
+    lock, host, DART_RWLOCK_SLOT_STATE, -DART_RWLOCK_WRITER, MPI_SUM);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), lock->gptr.segid);
+  int32_t one = 1;
+  for (int u = 0; u < team_data->size; ++u) {
+    DART_ASSERT_RETURNS(
+      MPI_Accumulate(
+        &one, 1, MPI_INT32_T,
+        u, rwlock_disp(seginfo, DART_TEAM_UNIT_ID(u), DART_RWLOCK_SLOT_GEN),
+        1, MPI_INT32_T, MPI_SUM, seginfo->win),
+      MPI_SUCCESS);
+  }
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush_all(seginfo->win),
+    MPI_SUCCESS);
+}
+
+dart_ret_t dart_rwlock_acquire(dart_rwlock_t lock)
+{
+  if (lock == DART_RWLOCK_NULL) {
+    return DART_ERR_INVAL;
+  }
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+
+  rwlock_enqueue_writer(lock, false);
+
+  // announce the writer and wait for active readers to leave
+  dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+  int32_t state = rwlock_fetch_op(
+                    lock, host, DART_RWLOCK_SLOT_STATE,
+                    DART_RWLOCK_WRITER, MPI_SUM);
+  while (state != 0) {
+    state = rwlock_fetch(lock, host, DART_RWLOCK_SLOT_STATE)
+            - DART_RWLOCK_WRITER;
+  }
+
+  lock->is_acquired = 1;
+  DART_LOG_DEBUG("dart_rwlock_acquire: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire(dart_rwlock_t lock, int32_t *result)
+{
+  *result = 0;
+  if (lock == DART_RWLOCK_NULL) {
+    return DART_ERR_INVAL;
+  }
+  if (dart__base__mutex_trylock(&lock->mutex) != DART_OK) {
+    return DART_OK;
+  }
+
+  if (rwlock_enqueue_writer(lock, true)) {
+    dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+    int32_t state = rwlock_fetch_op(
+                      lock, host, DART_RWLOCK_SLOT_STATE,
+                      DART_RWLOCK_WRITER, MPI_SUM);
+    if (state == 0) {
+      lock->is_acquired = 1;
+      *result = 1;
+      return DART_OK;
+    }
+    // readers are active, back off
+    rwlock_clear_writer(lock);
+    rwlock_dequeue_writer(lock);
+  }
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release(dart_rwlock_t lock)
+{
+  if (lock == DART_RWLOCK_NULL || lock->is_acquired == 0) {
+    DART_LOG_ERROR("dart_rwlock_release: LOCK has not been acquired before");
+    return DART_ERR_INVAL;
+  }
+  lock->is_acquired = 0;
+  rwlock_clear_writer(lock);
+  rwlock_dequeue_writer(lock);
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  DART_LOG_DEBUG("dart_rwlock_release: released lock in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire_shared(dart_rwlock_t lock)
+{
+  if (lock == DART_RWLOCK_NULL) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+  while (1) {
+    // read the generation before announcing, a writer releasing after we
+    // found it present will have incremented it
+    int32_t gen   = rwlock_fetch(lock, lock->myid, DART_RWLOCK_SLOT_GEN);
+    int32_t state = rwlock_fetch_op(
+                      lock, host, DART_RWLOCK_SLOT_STATE, 1, MPI_SUM);
+    if (state < DART_RWLOCK_WRITER) {
+      break;
+    }
+    rwlock_fetch_op(lock, host, DART_RWLOCK_SLOT_STATE, -1, MPI_SUM);
+    DART_LOG_TRACE("dart_rwlock_acquire_shared: waiting for writer");
+    rwlock_wait_local(lock, DART_RWLOCK_SLOT_GEN, gen);
+  }
+  DART_LOG_DEBUG("dart_rwlock_acquire_shared: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire_shared(dart_rwlock_t lock, int32_t *result)
+{
+  *result = 0;
+  if (lock == DART_RWLOCK_NULL) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+  int32_t state = rwlock_fetch_op(
+                    lock, host, DART_RWLOCK_SLOT_STATE, 1, MPI_SUM);
+  if (state < DART_RWLOCK_WRITER) {
+    *result = 1;
+  } else {
+    rwlock_fetch_op(lock, host, DART_RWLOCK_SLOT_STATE, -1, MPI_SUM);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release_shared(dart_rwlock_t lock)
+{
+  if (lock == DART_RWLOCK_NULL) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_unit_t host = DART_TEAM_UNIT_ID(DART_RWLOCK_HOST);
+  rwlock_fetch_op(lock, host, DART_RWLOCK_SLOT_STATE, -1, MPI_SUM);
+  DART_LOG_DEBUG("dart_rwlock_release_shared: released lock in team %d",
+                 lock->teamid);
   return DART_OK;
 }
@@ -635,6 +635,10 @@ dart_ret_t dart_team_create(
 
     team_data->allocated_locks = NULL;
 
+    if (dart_adapt_team_unit_tables_init(team_data) != DART_OK) {
+      return DART_ERR_OTHER;
+    }
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
     dart_allocate_shared_comm(team_data);
 #endif
@@ -672,6 +676,7 @@ dart_ret_t dart_team_destroy(
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
 #endif
+  dart_adapt_team_unit_tables_fini(team_data);
   win = team_data->window;
   MPI_Win_unlock_all(win);
   MPI_Win_free(&win);
@@ -772,62 +777,23 @@ dart_ret_t dart_team_unit_l2g(
   dart_team_unit_t     localid,
   dart_global_unit_t * globalid)
 {
-#if 0
-  dart_unit_t *unitids;
-  int size;
-  int i = 0;
-  dart_group_t group;
-  dart_team_get_group (teamid, &group);
-  MPI_Group_size (group.mpi_group, &size);
-  if (localid >= size)
-  {
-    DART_LOG_ERROR ("Invalid localid input");
-    return DART_ERR_INVAL;
-  }
-  unitids = (dart_unit_t*)malloc (sizeof(dart_unit_t) * size);
-  dart_group_getmembers (&group, unitids);
-
-  /* The unitids array is arranged in ascending order. */
-  *globalid = unitids[localid];
-//  printf ("globalid is %d\n", *globalid);
-  return DART_OK;
-#endif
-
-  int size;
-  dart_group_t group;
-
   if (globalid == NULL) {
     return DART_ERR_INVAL;
   }
 
   *globalid = DART_UNDEFINED_GLOBAL_UNIT_ID;
 
-  dart_team_get_group (teamid, &group);
-  if (group == NULL) {
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
     DART_LOG_ERROR("Unknown teamid: %i", teamid);
     return DART_ERR_INVAL;
   }
-  MPI_Group_size (group->mpi_group, &size);
 
-  if (localid.id >= size) {
-    dart_group_destroy(&group);
+  if (localid.id < 0 || localid.id >= team_data->size) {
     DART_LOG_ERROR ("Invalid localid input: %d", localid.id);
     return DART_ERR_INVAL;
   }
-  if (teamid == DART_TEAM_ALL) {
-    globalid->id = localid.id;
-  }
-  else {
-    MPI_Group group_all;
-    MPI_Comm_group(DART_COMM_WORLD, &group_all);
-    MPI_Group_translate_ranks(
-      group->mpi_group,
-      1,
-      &(localid.id),
-      group_all,
-      &(globalid->id));
-  }
-  dart_group_destroy(&group);
+  *globalid = team_data->unit_l2g[localid.id];
 
   return DART_OK;
 }
@@ -837,51 +803,22 @@ dart_ret_t dart_team_unit_g2l(
   dart_global_unit_t   globalid,
   dart_team_unit_t   * localid)
 {
-#if 0
-  dart_unit_t *unitids;
-  int size;
-  int i;
-  dart_group_t group;
-  dart_team_get_group (teamid, &group);
-  MPI_Group_size (group.mpi_group, &size);
-  unitids = (dart_unit_t *)malloc (sizeof (dart_unit_t) * size);
-
-  dart_group_getmembers (&group, unitids);
-
-
-  for (i = 0; (i < size) && (unitids[i] < globalid); i++);
-
-  if ((i == size) || (unitids[i] > globalid))
-  {
-    *localid = -1;
-    return DART_OK;
-  }
-
-  *localid = i;
-  return DART_OK;
-#endif
   if (localid == NULL) {
     return DART_ERR_INVAL;
   }
-  if(teamid == DART_TEAM_ALL) {
-    localid->id = globalid.id;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("Invalid teamid: %i", teamid);
+    return DART_ERR_INVAL;
   }
-  else {
-    dart_group_t group;
-    MPI_Group group_all;
-    dart_team_get_group(teamid, &group);
-    if (group == NULL) {
-      DART_LOG_ERROR("Invalid teamid: %i", teamid);
-      return DART_ERR_INVAL;
-    }
-    MPI_Comm_group(DART_COMM_WORLD, &group_all);
-    MPI_Group_translate_ranks(
-      group_all,
-      1,
-      &(globalid.id),
-      group->mpi_group,
-      &(localid->id));
-    dart_group_destroy(&group);
+
+  dart_team_data_t *team_data_all = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  if (globalid.id < 0 || globalid.id >= team_data_all->size) {
+    DART_LOG_ERROR("Invalid globalid input: %d", globalid.id);
+    return DART_ERR_INVAL;
   }
+  *localid = team_data->unit_g2l[globalid.id];
+
   return DART_OK;
 }
@@ -255,6 +255,55 @@ dart_ret_t dart_adapt_teamlist_destroy()
   return DART_OK;
 }
 
+dart_ret_t dart_adapt_team_unit_tables_init(dart_team_data_t *team_data)
+{
+  int size_all;
+  MPI_Comm_size(DART_COMM_WORLD, &size_all);
+
+  team_data->unit_l2g = malloc(team_data->size * sizeof(dart_global_unit_t));
+  team_data->unit_g2l = malloc(size_all * sizeof(dart_team_unit_t));
+  if (team_data->unit_l2g == NULL || team_data->unit_g2l == NULL) {
+    DART_LOG_ERROR("Failed to allocate unit translation tables of team %d",
+                   team_data->teamid);
+    dart_adapt_team_unit_tables_fini(team_data);
+    return DART_ERR_OTHER;
+  }
+
+  MPI_Group group, group_all;
+  MPI_Comm_group(team_data->comm, &group);
+  MPI_Comm_group(DART_COMM_WORLD, &group_all);
+
+  int *ranks        = malloc(team_data->size * sizeof(int));
+  int *global_ranks = malloc(team_data->size * sizeof(int));
+  for (int i = 0; i < team_data->size; i++) {
+    ranks[i] = i;
+  }
+  MPI_Group_translate_ranks(
+    group, team_data->size, ranks, group_all, global_ranks);
+  MPI_Group_free(&group);
+  MPI_Group_free(&group_all);
+
+  for (int i = 0; i < size_all; i++) {
+    team_data->unit_g2l[i] = DART_UNDEFINED_TEAM_UNIT_ID;
+  }
+  for (int i = 0; i < team_data->size; i++) {
+    team_data->unit_l2g[i] = DART_GLOBAL_UNIT_ID(global_ranks[i]);
+    team_data->unit_g2l[global_ranks[i]] = DART_TEAM_UNIT_ID(i);
+  }
+  free(ranks);
+  free(global_ranks);
+
+  return DART_OK;
+}
+
+void dart_adapt_team_unit_tables_fini(dart_team_data_t *team_data)
+{
+  free(team_data->unit_l2g);
+  team_data->unit_l2g = NULL;
+  free(team_data->unit_g2l);
+  team_data->unit_g2l = NULL;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
 {
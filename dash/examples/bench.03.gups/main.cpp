@@ -44,6 +44,7 @@ typedef struct benchmark_params_t {
   size_t size_base;
   size_t num_updates;
   size_t rep_base;
+  size_t agg_threshold;
   bool   verify;
 } benchmark_params;
 
@@ -102,6 +103,19 @@ void RandomAccessUpdate(const benchmark_params & params)
   uint64_t ran = starts(params.num_updates / dash::size() * dash::myid());
   auto     table_size = params.size_base;
 
+  if (params.agg_threshold > 0) {
+    // Buffer updates per target unit and apply them in batches:
+    dash::Aggregator<value_t, dash::bit_xor<value_t>, decltype(Table)>
+      agg(Table, params.agg_threshold);
+    for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
+      ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
+      int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
+      agg.update(g_idx, ran);
+    }
+    agg.flush();
+    return;
+  }
+
   for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
     ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
     int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
@@ -279,10 +293,11 @@ void perform_test(const benchmark_params & params)
 benchmark_params parse_args(int argc, char * argv[])
 {
   benchmark_params params;
-  params.size_base   = TableSize;
-  params.num_updates = NUPDATE;
-  params.rep_base    = 1;
-  params.verify      = false;
+  params.size_base     = TableSize;
+  params.num_updates   = NUPDATE;
+  params.rep_base      = 1;
+  params.agg_threshold = 0;
+  params.verify        = false;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -290,6 +305,8 @@ benchmark_params parse_args(int argc, char * argv[])
       params.size_base = atoi(argv[i+1]);
     } else if (flag == "-rb") {
       params.rep_base  = atoi(argv[i+1]);
+    } else if (flag == "-agg") {
+      params.agg_threshold = atoi(argv[i+1]);
     } else if (flag == "-verify") {
       params.verify    = true;
       --i;
@@ -309,6 +326,7 @@ void print_params(
   bench_cfg.print_section_start("Runtime arguments");
   bench_cfg.print_param("-sb",     "size base",    params.size_base);
   bench_cfg.print_param("-rb",     "rep. base",    params.rep_base);
+  bench_cfg.print_param("-agg",    "aggregation",  params.agg_threshold);
   bench_cfg.print_param("-verify", "verification", params.verify);
   bench_cfg.print_section_end();
 }
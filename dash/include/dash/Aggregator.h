@@ -0,0 +1,130 @@
+#ifndef DASH__AGGREGATOR_H__INCLUDED
+#define DASH__AGGREGATOR_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Array.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/Operation.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * Buffers fine-grained atomic updates of elements in a DASH container
+ * and applies them to the owning units in batches.
+ *
+ * Updates issued with \c update are only guaranteed to be complete after
+ * \c flush returned, the updates of other units only after a subsequent
+ * barrier. Updates of the same element are applied in the order in which
+ * they were issued by the calling unit.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<uint64_t> table(size);
+ *   dash::Aggregator<uint64_t, dash::bit_xor<uint64_t>> agg(table);
+ *   for (auto i = 0; i < num_updates; ++i) {
+ *     agg.update(random_index(), value);
+ *   }
+ *   agg.flush();
+ *   table.barrier();
+ * \endcode
+ *
+ * \tparam  ValueType        The element type of the container.
+ * \tparam  BinaryOperation  A pre-defined DASH reduce operation such as
+ *                           \c dash::plus or \c dash::bit_xor.
+ * \tparam  ContainerType    The container holding the updated elements.
+ *
+ * \sa dart_aggregator_create
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation = dash::plus<ValueType>,
+  class    ContainerType   = dash::Array<ValueType> >
+class Aggregator
+{
+  static_assert(
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED,
+    "Aggregator requires a value type that maps to a basic DART type");
+  static_assert(
+    BinaryOperation::dart_operation() != DART_OP_UNDEFINED &&
+    BinaryOperation::dart_operation() != DART_OP_NO_OP,
+    "Aggregator requires a pre-defined DASH operation");
+
+private:
+  typedef Aggregator<ValueType, BinaryOperation, ContainerType> self_t;
+
+public:
+  typedef ValueType                           value_type;
+  typedef typename ContainerType::index_type  index_type;
+
+public:
+  /**
+   * Creates an aggregator for updates of elements in \c container.
+   *
+   * \param container  The container holding the updated elements.
+   * \param threshold  The number of updates buffered per unit before they
+   *                   are shipped, \c 0 to use the DART default.
+   */
+  explicit Aggregator(
+    ContainerType & container,
+    size_t          threshold = 0)
+  : _container(container)
+  {
+    DASH_ASSERT_RETURNS(
+      dart_aggregator_create(
+        container.team().dart_id(),
+        dash::dart_datatype<ValueType>::value,
+        BinaryOperation::dart_operation(),
+        threshold,
+        &_agg),
+      DART_OK);
+  }
+
+  /**
+   * Destructor, completes all pending updates.
+   */
+  ~Aggregator()
+  {
+    dart_aggregator_destroy(&_agg);
+  }
+
+  Aggregator(const self_t & other)         = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Buffers the update of the element at global index \c g_index with
+   * \c value.
+   */
+  void update(index_type g_index, const value_type & value)
+  {
+    DASH_ASSERT_RETURNS(
+      dart_aggregator_add(
+        _agg,
+        (_container.begin() + g_index).dart_gptr(),
+        &value),
+      DART_OK);
+  }
+
+  /**
+   * Ships all buffered updates and waits for their completion.
+   */
+  void flush()
+  {
+    DASH_ASSERT_RETURNS(
+      dart_aggregator_flush(_agg),
+      DART_OK);
+  }
+
+private:
+  ContainerType     & _container;
+  dart_aggregator_t   _agg = nullptr;
+};
+
+} // namespace dash
+
+#endif // DASH__AGGREGATOR_H__INCLUDED
@@ -1,6 +1,9 @@
 #ifndef DASH__COEVENT_H__INCLUDED
 #define DASH__COEVENT_H__INCLUDED
 
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <thread>
 
 #include <dash/Array.h>
@@ -110,20 +113,35 @@ public:
    * This function is thread-safe
    */
   inline void wait(int count = 1) {
-    auto gref = _event_counts.at(_team->myid().id);
-    int current;
-    do {
-#ifdef DASH_DEBUG
-      // avoid spamming the logs while busy waiting
-      DASH_LOG_DEBUG("waiting for event at gptr",
-                     static_cast<pointer>(_event_counts.begin()
-                                         +_team->myid().id));
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-#endif
-      current = gref.get();
-    } while (current < count);
-    // decrement the counter
-    gref.sub(count);
+    poll_events(count, []() { return true; });
+  }
+
+  /**
+   * wait for a given number of incoming events for at most \c timeout.
+   * The events are only consumed if all of them arrived in time.
+   *
+   * \return  true if \c count events arrived, false on timeout.
+   */
+  template <class Rep, class Period>
+  inline bool wait_for(
+    const std::chrono::duration<Rep, Period> & timeout,
+    int                                        count = 1) {
+    return wait_until(std::chrono::steady_clock::now() + timeout, count);
+  }
+
+  /**
+   * wait for a given number of incoming events until \c deadline.
+   * The events are only consumed if all of them arrived in time.
+   *
+   * \return  true if \c count events arrived, false on timeout.
+   */
+  template <class Clock, class Duration>
+  inline bool wait_until(
+    const std::chrono::time_point<Clock, Duration> & deadline,
+    int                                              count = 1) {
+    return poll_events(count, [&deadline]() {
+                                return Clock::now() < deadline;
+                              });
   }
 
   inline int test() {
@@ -131,6 +149,23 @@ public:
     return _event_counts.at(static_cast<int>(_team->myid())).load();
   }
 
+  /**
+   * Tests the coevents in the range \c [first, last) for incoming events
+   * on this unit without consuming them.
+   *
+   * \return  An iterator to the first coevent with at least \c count
+   *          incoming events, \c last if there is none.
+   */
+  template <class CoeventIter>
+  static CoeventIter test_any(
+    CoeventIter first,
+    CoeventIter last,
+    int         count = 1) {
+    return std::find_if(first, last, [count](Coevent & event) {
+                                       return event.test() >= count;
+                                     });
+  }
+
   /**
    * initializes the Coevent. If it was already initialized in the Ctor,
    * the second initialization is skipped.
@@ -165,6 +200,46 @@ public:
     return this->operator()(static_cast<int>(unit));
   }
 
+private:
+  /**
+   * Polls the local event counter until \c count events arrived and
+   * consumes them, or until \c keep_waiting returns false.
+   * Reading the counter drives progress in DART. Waiting units back off
+   * from busy polling to yielding and finally to short sleeps, so that
+   * units sharing a core with the posting unit do not starve it.
+   */
+  template <class Predicate>
+  inline bool poll_events(int count, Predicate keep_waiting) {
+    auto gref = _event_counts.at(_team->myid().id);
+    DASH_LOG_DEBUG("waiting for event at gptr",
+                   static_cast<pointer>(_event_counts.begin()
+                                       +_team->myid().id));
+    for (int round = 0; gref.get() < count; ++round) {
+      if (!keep_waiting()) {
+        return false;
+      }
+      backoff(round);
+    }
+    // decrement the counter
+    gref.sub(count);
+    return true;
+  }
+
+  static inline void backoff(int round) {
+    constexpr int spin_rounds  = 64;
+    constexpr int yield_rounds = 128;
+    constexpr int max_shift    = 7;
+    if (round < spin_rounds) {
+      return;
+    }
+    if (round < yield_rounds) {
+      std::this_thread::yield();
+      return;
+    }
+    auto shift = std::min(round - yield_rounds, max_shift);
+    std::this_thread::sleep_for(std::chrono::microseconds(1 << shift));
+  }
+
 private:
   Team * _team;
   bool   _is_initialized = false;
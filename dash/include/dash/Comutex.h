@@ -5,6 +5,9 @@
 #include <dash/Team.h>
 #include <dash/Mutex.h>
 
+#include <dash/dart/if/dart_synchronization.h>
+
+#include <utility>
 #include <vector>
 
 namespace dash {
@@ -19,9 +22,8 @@ namespace dash {
  * The interface is similar to \c dash::Coarray but does not allow
  * local accesses. Hence it does not fulfill the DASH Container Concept.
  *
- * \note In its current implementation the Comutex does not scale well as
- *       each unit stores internally one \dash::mutex per unit. Hence, use this
- *       only for small teams.
+ * The mutexes of all units are allocated in a single collective
+ * operation, see \c dart_team_lock_array_init.
  *
  * Example:
  *
@@ -36,12 +38,6 @@ namespace dash {
  *  arr(i) = 42;
  * }
  * \endcode
- *
- * \TODO: Use custom mutex to avoid storing the team multiple times
- *        (Each \c dash::Mutex) contains the team itself.
- *
- *
- *
  */
 class Comutex {
 private:
@@ -65,6 +61,33 @@ public:
     }
   }
 
+  Comutex(const Comutex & other) = delete;
+  Comutex(Comutex && other)      = default;
+
+  Comutex & operator=(const Comutex & other) = delete;
+  Comutex & operator=(Comutex && other) {
+    std::swap(_mutexes, other._mutexes);
+    std::swap(_locks, other._locks);
+    std::swap(_team, other._team);
+    std::swap(_is_initialized, other._is_initialized);
+    return *this;
+  }
+
+  /**
+   * Collective destructor releasing the DART locks.
+   */
+  ~Comutex() {
+    _mutexes.clear();
+    if (!_locks.empty()) {
+      if (dart_team_lock_array_destroy(_locks.size(), _locks.data())
+          != DART_OK) {
+        DASH_LOG_ERROR(
+            "Failed to destroy DART locks! "
+            "(dart_team_lock_array_destroy failed)");
+      }
+    }
+  }
+
   iterator begin() noexcept {
     return _mutexes.begin();
   }
@@ -92,9 +115,14 @@ public:
   inline void initialize(Team & team){
     if(!_is_initialized){
       _team = &team;
+      _locks.resize(team.size(), DART_LOCK_NULL);
+      DASH_ASSERT_RETURNS(
+        dart_team_lock_array_init(
+          team.dart_id(), _locks.size(), _locks.data()),
+        DART_OK);
       _mutexes.reserve(team.size());
-      for(decltype(team.size()) i = 0; i<team.size(); ++i){
-        _mutexes.emplace_back(team);
+      for (auto lock : _locks) {
+        _mutexes.push_back(dash::Mutex(team, lock));
       }
     } else {
       DASH_ASSERT_MSG((team == *_team),
@@ -123,7 +151,8 @@ public:
   }
 
 private:
-  _storage_type  _mutexes;
+  _storage_type            _mutexes;
+  std::vector<dart_lock_t> _locks;
   Team         * _team{};
   bool           _is_initialized = false;
 };
@@ -3,11 +3,17 @@
 
 #include <cstddef>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <sstream>
 #include <iostream>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <dash/Exception.h>
 #include <dash/internal/Logging.h>
+#include <dash/internal/SmallFunction.h>
 
 
 namespace dash {
@@ -25,17 +31,17 @@ public:
   /**
    * Callback function returning the result value.
    */
-  typedef std::function<ResultT (void)>  get_func_t;
+  typedef internal::SmallFunction<ResultT (void)>  get_func_t;
 
   /**
    * Callback function to test for the availability of the result value.
    */
-  typedef std::function<bool (ResultT*)> test_func_t;
+  typedef internal::SmallFunction<bool (ResultT*)> test_func_t;
 
   /**
    * Callback function called upon destruction.
    */
-  typedef std::function<void (void)>     destroy_func_t;
+  typedef internal::SmallFunction<void (void)>     destroy_func_t;
 
 private:
   /// Function returning the value
@@ -214,6 +220,21 @@ public:
     return _value;
   }
 
+  /**
+   * Attach the continuation \c func which is invoked with the value of this
+   * future once it is available.
+   *
+   * This future is moved into the returned future and must not be used
+   * afterwards.
+   *
+   * \return  A future for the value returned by \c func. Testing it tests
+   *          this future and invokes \c func as soon as the value is
+   *          available.
+   */
+  template<typename FuncT>
+  auto then(FuncT && func)
+    -> Future<decltype(func(std::declval<ResultT>()))>;
+
 
   /**
    * Check whether the future is valid, i.e., whether either a value or a
@@ -240,17 +261,17 @@ public:
   /**
    * Callback function to wait for completion.
    */
-  typedef std::function<void (void)> get_func_t;
+  typedef internal::SmallFunction<void (void)> get_func_t;
 
   /**
    * Callback function to test for completion.
    */
-  typedef std::function<bool (void)> test_func_t;
+  typedef internal::SmallFunction<bool (void)> test_func_t;
 
   /**
    * Callback function called upon destruction.
    */
-  typedef std::function<void (void)> destroy_func_t;
+  typedef internal::SmallFunction<void (void)> destroy_func_t;
 
 private:
   /// Function returning the value
@@ -420,6 +441,21 @@ public:
     DASH_LOG_TRACE("Future.get >");
   }
 
+  /**
+   * Attach the continuation \c func which is invoked once the operation
+   * is complete.
+   *
+   * This future is moved into the returned future and must not be used
+   * afterwards.
+   *
+   * \return  A future for the value returned by \c func. Testing it tests
+   *          this future and invokes \c func as soon as the operation is
+   *          complete.
+   */
+  template<typename FuncT>
+  auto then(FuncT && func)
+    -> Future<decltype(func())>;
+
   /**
    * Check whether the future is valid, i.e., a function to wait for completion
    * has been provided.
@@ -431,6 +467,227 @@ public:
 
 }; // class Future
 
+namespace internal {
+
+/**
+ * State of a future created through \c dash::Future::then, shared between
+ * the callbacks of the returned future.
+ */
+template<typename FutureT, typename FuncT>
+struct FutureContinuation
+{
+  FutureContinuation(FutureT && p, FuncT && f)
+  : prev(std::move(p)),
+    func(std::move(f))
+  { }
+
+  FutureT prev;
+  FuncT   func;
+};
+
+template<typename ResultT, typename FuncT>
+auto invoke_continuation(Future<ResultT> & prev, FuncT & func)
+  -> decltype(func(prev.get()))
+{
+  return func(prev.get());
+}
+
+template<typename FuncT>
+auto invoke_continuation(Future<void> & prev, FuncT & func)
+  -> decltype(func())
+{
+  prev.get();
+  return func();
+}
+
+template<typename ResultT>
+struct make_continuation
+{
+  template<typename StateT>
+  static Future<ResultT> make(std::shared_ptr<StateT> state)
+  {
+    return Future<ResultT>(
+      [state]() {
+        return invoke_continuation(state->prev, state->func);
+      },
+      [state](ResultT * result) {
+        if (!state->prev.test()) {
+          return false;
+        }
+        *result = invoke_continuation(state->prev, state->func);
+        return true;
+      });
+  }
+};
+
+template<>
+struct make_continuation<void>
+{
+  template<typename StateT>
+  static Future<void> make(std::shared_ptr<StateT> state)
+  {
+    return Future<void>(
+      [state]() {
+        invoke_continuation(state->prev, state->func);
+      },
+      [state]() {
+        if (!state->prev.test()) {
+          return false;
+        }
+        invoke_continuation(state->prev, state->func);
+        return true;
+      });
+  }
+};
+
+template<typename Tuple, std::size_t... Is>
+bool test_all(const Tuple & futures, std::index_sequence<Is...>)
+{
+  bool ready = true;
+  // test all futures to drive the progress of all operations
+  int expand[] = { 0, (ready = std::get<Is>(futures)->test() && ready, 0)... };
+  (void)expand;
+  return ready;
+}
+
+template<typename Tuple, std::size_t... Is>
+std::size_t test_any(const Tuple & futures, std::index_sequence<Is...>)
+{
+  std::size_t idx = std::numeric_limits<std::size_t>::max();
+  int expand[] = { 0, ((idx == std::numeric_limits<std::size_t>::max() &&
+                        std::get<Is>(futures)->test())
+                       ? (idx = Is, 0) : 0)... };
+  (void)expand;
+  return idx;
+}
+
+} // namespace internal
+
+template<typename ResultT>
+template<typename FuncT>
+auto Future<ResultT>::then(FuncT && func)
+  -> Future<decltype(func(std::declval<ResultT>()))>
+{
+  typedef decltype(func(std::declval<ResultT>())) result_t;
+  typedef internal::FutureContinuation<
+            self_t, typename std::decay<FuncT>::type> state_t;
+  return internal::make_continuation<result_t>::make(
+           std::make_shared<state_t>(std::move(*this),
+                                     std::forward<FuncT>(func)));
+}
+
+template<typename FuncT>
+auto Future<void>::then(FuncT && func)
+  -> Future<decltype(func())>
+{
+  typedef decltype(func()) result_t;
+  typedef internal::FutureContinuation<
+            self_t, typename std::decay<FuncT>::type> state_t;
+  return internal::make_continuation<result_t>::make(
+           std::make_shared<state_t>(std::move(*this),
+                                     std::forward<FuncT>(func)));
+}
+
+/**
+ * Create a future that is ready once all of the given futures are ready.
+ *
+ * Waiting for the returned future tests all futures in turn instead of
+ * waiting for them in program order. Once it is ready, the values of the
+ * given futures can be accessed without blocking. The given futures must
+ * outlive the returned future.
+ */
+template<typename... FutureTs>
+Future<void> when_all(FutureTs &... futures)
+{
+  auto futs = std::make_tuple(&futures...);
+  auto seq  = std::index_sequence_for<FutureTs...>();
+  return Future<void>(
+    [futs, seq]() {
+      while (!internal::test_all(futs, seq)) { }
+    },
+    [futs, seq]() {
+      return internal::test_all(futs, seq);
+    });
+}
+
+/**
+ * Create a future that is ready once all futures in the range
+ * \c [first, last) are ready.
+ *
+ * \see dash::when_all
+ */
+template<typename FutureIter>
+Future<void> when_all(FutureIter first, FutureIter last)
+{
+  auto test_func = [first, last]() {
+    bool ready = true;
+    for (auto it = first; it != last; ++it) {
+      ready = it->test() && ready;
+    }
+    return ready;
+  };
+  return Future<void>(
+    [test_func]() {
+      while (!test_func()) { }
+    },
+    test_func);
+}
+
+/**
+ * Create a future that is ready once any of the given futures is ready.
+ *
+ * The value of the returned future is the position of the first ready
+ * future in the argument list. The given futures must outlive the returned
+ * future.
+ */
+template<typename... FutureTs>
+Future<std::size_t> when_any(FutureTs &... futures)
+{
+  auto futs = std::make_tuple(&futures...);
+  auto seq  = std::index_sequence_for<FutureTs...>();
+  return Future<std::size_t>(
+    [futs, seq]() {
+      std::size_t idx;
+      while ((idx = internal::test_any(futs, seq))
+             == std::numeric_limits<std::size_t>::max()) { }
+      return idx;
+    },
+    [futs, seq](std::size_t * idx) {
+      *idx = internal::test_any(futs, seq);
+      return (*idx != std::numeric_limits<std::size_t>::max());
+    });
+}
+
+/**
+ * Create a future that is ready once any future in the range
+ * \c [first, last) is ready.
+ *
+ * The value of the returned future is the position of the first ready
+ * future in the range.
+ *
+ * \see dash::when_any
+ */
+template<typename FutureIter>
+Future<std::size_t> when_any(FutureIter first, FutureIter last)
+{
+  auto test_func = [first, last](std::size_t * idx) {
+    for (auto it = first; it != last; ++it) {
+      if (it->test()) {
+        *idx = static_cast<std::size_t>(std::distance(first, it));
+        return true;
+      }
+    }
+    return false;
+  };
+  return Future<std::size_t>(
+    [test_func]() {
+      std::size_t idx;
+      while (!test_func(&idx)) { }
+      return idx;
+    },
+    test_func);
+}
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
@@ -6,6 +6,8 @@
 
 namespace dash {
 
+class Comutex;
+
 /**
  * Behaves similar to \c std::mutex and is used to ensure mutual exclusion
  * within a dash team.
@@ -32,9 +34,20 @@ private:
   using self_t = Mutex;
 
   struct DestroyDARTLock {
+    DestroyDARTLock()
+      : owner(true)
+    { }
+
+    explicit DestroyDARTLock(bool is_owner)
+      : owner(is_owner)
+    { }
+
+    /// Whether the lock is owned or part of a lock array
+    bool owner;
+
     void operator()(dart_lock_t lock)
     {
-      if (DART_LOCK_NULL != lock) {
+      if (owner && DART_LOCK_NULL != lock) {
         auto ret = dart_team_lock_destroy(&lock);
 
         if (ret != DART_OK) {
@@ -94,6 +107,17 @@ public:
    */
   void unlock();
 
+private:
+  friend class Comutex;
+
+  /**
+   * Wraps a lock of a lock array, which is owned by the caller.
+   */
+  Mutex(Team& team, dart_lock_t lock)
+    : _team(&team)
+    , _mutex(lock, DestroyDARTLock{false})
+  { }
+
 private:
   dash::Team const* _team{nullptr};
   std::unique_ptr<std::remove_pointer<dart_lock_t>::type, DestroyDARTLock>
@@ -142,6 +142,145 @@ namespace internal {
       DART_OK);
   }
 
+  /**
+   * Write of \c nelem values from \c src to the global memory
+   * location referenced by \c gptr. The operation is added to \c group
+   * and completed together with the other operations in it.
+   *
+   * \sa dart_handle_group_put
+   */
+  template<typename T>
+  inline
+  void
+  put_group(
+    const dart_gptr_t   & gptr,
+    const T             * src,
+    size_t                nelem,
+    dart_handle_group_t   group) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_handle_group_put(group,
+                            gptr,
+                            src,
+                            ds.nelem,
+                            ds.dtype,
+                            ds.dtype),
+      DART_OK);
+  }
+
+  /**
+   * Non-blocking read of \c nelem values the global memory
+   * location referenced by \c gptr into memory referenced by \c dst.
+   * The operation is added to \c group and completed together with the
+   * other operations in it.
+   *
+   * \sa dart_handle_group_get
+   */
+  template<typename T>
+  inline
+  void
+  get_group(
+    const dart_gptr_t   & gptr,
+    T                   * dst,
+    size_t                nelem,
+    dart_handle_group_t   group) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_handle_group_get(group,
+                            dst,
+                            gptr,
+                            ds.nelem,
+                            ds.dtype,
+                            ds.dtype),
+      DART_OK);
+  }
+
+  /**
+   * Blocking read of one value from each of the \c num global memory
+   * locations referenced by \c gptrs into the memory referenced by the
+   * respective element of \c dst.
+   *
+   * \sa dart_getv
+   */
+  template<typename T>
+  inline
+  void
+  getv(const dart_gptr_t * gptrs, T * const * dst, size_t num) {
+    dash::dart_storage<T> ds(1);
+    DASH_ASSERT_RETURNS(
+      dart_getv(reinterpret_cast<void * const *>(dst),
+                gptrs,
+                num,
+                ds.nelem,
+                ds.dtype),
+      DART_OK);
+  }
+
+  /**
+   * Blocking write of one value from each of the \c num local memory
+   * locations referenced by \c src to the respective global memory
+   * location referenced by \c gptrs.
+   *
+   * \sa dart_putv
+   */
+  template<typename T>
+  inline
+  void
+  putv(const dart_gptr_t * gptrs, const T * const * src, size_t num) {
+    dash::dart_storage<T> ds(1);
+    DASH_ASSERT_RETURNS(
+      dart_putv(gptrs,
+                reinterpret_cast<const void * const *>(src),
+                num,
+                ds.nelem,
+                ds.dtype),
+      DART_OK);
+  }
+
+  /**
+   * Blocking write of \c nelem values from \c src to the global memory
+   * location referenced by \c gptr, followed by an atomic increment of
+   * the counter referenced by \c notify_gptr by \c value.
+   * The increment becomes visible at the target only after the payload
+   * has been written.
+   *
+   * \sa dart_put_notify
+   * \sa dash::internal::notify_wait
+   */
+  template<typename T>
+  inline
+  void
+  put_notify(
+    const dart_gptr_t & gptr,
+    const T           * src,
+    size_t              nelem,
+    const dart_gptr_t & notify_gptr,
+    int64_t             value = 1) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_put_notify(gptr,
+                      src,
+                      ds.nelem,
+                      ds.dtype,
+                      notify_gptr,
+                      value),
+      DART_OK);
+  }
+
+  /**
+   * Block until the local notification counter referenced by
+   * \c counter has reached at least \c expected.
+   *
+   * \sa dart_notify_wait
+   */
+  inline
+  void
+  notify_wait(const dart_gptr_t & counter, int64_t expected) {
+    DASH_ASSERT_RETURNS(
+      dart_notify_wait(counter, expected),
+      DART_OK);
+  }
+
 } // namespace internal
 
 /**
@@ -0,0 +1,127 @@
+#ifndef DASH__SHARED_MUTEX_H__INCLUDED
+#define DASH__SHARED_MUTEX_H__INCLUDED
+
+#include <dash/Team.h>
+#include <dash/dart/if/dart_synchronization.h>
+
+namespace dash {
+
+/**
+ * Behaves similar to \c std::shared_mutex and is used to allow either
+ * exclusive access of a single unit or shared access of any number of
+ * units within a dash team.
+ *
+ * \note This works properly with \c std::lock_guard, \c std::unique_lock
+ *       and \c std::shared_lock
+ * \note SharedMutex cannot be placed in DASH containers
+ *
+ * \code
+ * dash::SharedMutex mx; // mutex for dash::Team::All();
+ * dash::Array<int> table(size);
+ * {
+ *    // any number of units may read concurrently
+ *    std::shared_lock<dash::SharedMutex> sl(mx);
+ *    int value = table[key];
+ * }
+ * {
+ *    // exclusive access for updates
+ *    std::lock_guard<dash::SharedMutex> lg(mx);
+ *    table[key] = value;
+ * }
+ * \endcode
+ *
+ * \sa dart_team_rwlock_init
+ */
+class SharedMutex {
+private:
+  using self_t = SharedMutex;
+
+  struct DestroyDARTLock {
+    void operator()(dart_rwlock_t lock)
+    {
+      if (DART_RWLOCK_NULL != lock) {
+        auto ret = dart_team_rwlock_destroy(&lock);
+
+        if (ret != DART_OK) {
+          DASH_LOG_ERROR(
+              "Failed to destroy DART reader-writer lock! "
+              "(dart_team_rwlock_destroy failed)");
+        }
+      }
+    }
+  };
+
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team& team = dash::Team::All());
+
+  SharedMutex(const SharedMutex& other) = delete;
+  SharedMutex(SharedMutex&& other)      = default;
+
+  self_t& operator=(const self_t& other) = delete;
+  self_t& operator=(self_t&& other) = default;
+
+  /**
+   * Collective destructor to destruct a DART reader-writer lock.
+   *
+   * This function is not thread-safe
+   */
+  ~SharedMutex() = default;
+
+  /**
+   * Collective initialization of the DART reader-writer lock.
+   *
+   * This function is not thread-safe
+   *
+   * @return True if lock was successfully initialized, False otherwise
+   */
+  bool init();
+
+  /**
+   * Block until the lock was acquired for exclusive access.
+   */
+  void lock();
+
+  /**
+   * Try to acquire the lock for exclusive access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock();
+
+  /**
+   * Release the lock acquired through \c lock() or \c try_lock().
+   */
+  void unlock();
+
+  /**
+   * Block until the lock was acquired for shared access.
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire the lock for shared access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Release the lock acquired through \c lock_shared() or
+   * \c try_lock_shared().
+   */
+  void unlock_shared();
+
+private:
+  dash::Team const* _team{nullptr};
+  std::unique_ptr<std::remove_pointer<dart_rwlock_t>::type, DestroyDARTLock>
+      _mutex{DART_RWLOCK_NULL};
+};  // class SharedMutex
+
+}  // namespace dash
+
+#endif  // DASH__SHARED_MUTEX_H__INCLUDED
@@ -0,0 +1,416 @@
+#ifndef DASH__TASKS_H__INCLUDED
+#define DASH__TASKS_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Future.h>
+#include <dash/internal/SmallFunction.h>
+
+#include <dash/dart/if/dart_globmem.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \defgroup DashTasksConcept  Tasks Concept
+ *
+ * \par Description
+ *
+ * Tasks are function objects that are executed asynchronously by a pool
+ * of worker threads on every unit. Every worker thread owns a deque of
+ * ready tasks and steals tasks from the deques of other threads once its
+ * own deque is empty, so irregular workloads are balanced among the
+ * threads of a unit without additional synchronization.
+ *
+ * The order of tasks created on a unit is specified by dependencies on
+ * ranges of global memory: a task with an \c out dependency on a range is
+ * executed after all previously created tasks with overlapping \c in or
+ * \c out dependencies, a task with an \c in dependency is executed after
+ * all previously created tasks with overlapping \c out dependencies.
+ *
+ * Tasks can also be created on remote units with \c dash::tasks::async_at
+ * to move work from overloaded units to other units. Functions executed
+ * by such tasks are registered on all units with
+ * \c dash::tasks::register_remote.
+ *
+ * The number of threads per unit is read from the environment variable
+ * \c DASH_NUM_THREADS and defaults to the number of cores assigned to the
+ * unit. The thread that created the first task executes tasks while
+ * waiting for them and is the only thread that communicates with other
+ * units on behalf of the task runtime. Tasks accessing global memory
+ * require DART with support for multi-threaded access
+ * (see \c dash::is_multithreaded).
+ *
+ * \code
+ *   dash::Array<double> arr(size);
+ *   auto fut_a = dash::tasks::async(
+ *                  [&]() { fill(arr.lbegin(), arr.lend()); },
+ *                  dash::tasks::out(arr.begin(), arr.end()));
+ *   // executed after the first task
+ *   auto fut_b = dash::tasks::async(
+ *                  [&]() { return sum(arr.lbegin(), arr.lend()); },
+ *                  dash::tasks::in(arr.begin(), arr.end()));
+ *   double sum = fut_b.get();
+ *   // wait for tasks on all units
+ *   dash::tasks::complete();
+ * \endcode
+ *
+ * \ingroup DashConcept
+ */
+
+namespace dash {
+namespace tasks {
+
+/**
+ * Dependency of a task on a range of elements in global memory.
+ *
+ * \ingroup DashTasksConcept
+ */
+class Dependency
+{
+public:
+  enum class Type : int {
+    /// The task reads from the range
+    In,
+    /// The task writes to the range
+    Out
+  };
+
+public:
+  Dependency(
+    Type                   type,
+    dart_gptr_t            gptr,
+    dash::default_index_t  begin,
+    dash::default_index_t  end)
+  : _type(type),
+    _teamid(gptr.teamid),
+    _segid(gptr.segid),
+    _begin(begin),
+    _end(end)
+  { }
+
+  Type type() const noexcept
+  {
+    return _type;
+  }
+
+  dart_team_t teamid() const noexcept
+  {
+    return _teamid;
+  }
+
+  int16_t segid() const noexcept
+  {
+    return _segid;
+  }
+
+  /// Global index of the first element in the range.
+  dash::default_index_t begin() const noexcept
+  {
+    return _begin;
+  }
+
+  /// Global index past the last element in the range.
+  dash::default_index_t end() const noexcept
+  {
+    return _end;
+  }
+
+private:
+  Type                  _type;
+  dart_team_t           _teamid;
+  int16_t               _segid;
+  dash::default_index_t _begin;
+  dash::default_index_t _end;
+};
+
+/**
+ * Input dependency on the elements in the global range
+ * \c [first, last).
+ *
+ * \ingroup DashTasksConcept
+ */
+template<typename GlobIterT>
+Dependency in(const GlobIterT & first, const GlobIterT & last)
+{
+  return Dependency(
+           Dependency::Type::In, first.dart_gptr(), first.pos(), last.pos());
+}
+
+/**
+ * Input dependency on the element referenced by the global iterator
+ * \c it.
+ *
+ * \ingroup DashTasksConcept
+ */
+template<typename GlobIterT>
+Dependency in(const GlobIterT & it)
+{
+  return Dependency(
+           Dependency::Type::In, it.dart_gptr(), it.pos(), it.pos() + 1);
+}
+
+/**
+ * Output dependency on the elements in the global range
+ * \c [first, last).
+ *
+ * \ingroup DashTasksConcept
+ */
+template<typename GlobIterT>
+Dependency out(const GlobIterT & first, const GlobIterT & last)
+{
+  return Dependency(
+           Dependency::Type::Out, first.dart_gptr(), first.pos(), last.pos());
+}
+
+/**
+ * Output dependency on the element referenced by the global iterator
+ * \c it.
+ *
+ * \ingroup DashTasksConcept
+ */
+template<typename GlobIterT>
+Dependency out(const GlobIterT & it)
+{
+  return Dependency(
+           Dependency::Type::Out, it.dart_gptr(), it.pos(), it.pos() + 1);
+}
+
+namespace internal {
+
+struct Task;
+
+typedef std::shared_ptr<Task> task_ptr_t;
+
+struct Task
+{
+  explicit Task(dash::internal::SmallFunction<void (void)> && f)
+  : func(std::move(f))
+  { }
+
+  /// The function executed by the task
+  dash::internal::SmallFunction<void (void)> func;
+  /// Number of unfinished predecessors, plus one until the task is created
+  std::atomic<int>                           num_predecessors{1};
+  /// Whether the task has been executed
+  std::atomic<bool>                          done{false};
+  /// Protects the list of successors
+  std::mutex                                 mutex;
+  /// Tasks waiting for this task to finish
+  std::vector<task_ptr_t>                    successors;
+};
+
+/**
+ * Function invoking the function \c func on an argument received from a
+ * remote unit.
+ */
+typedef void (*remote_invoke_t)(void (*func)(void), const void * arg);
+
+template<typename ArgT>
+void invoke_remote(void (*func)(void), const void * arg)
+{
+  // the argument is not necessarily aligned in the message buffer
+  typename std::aligned_storage<sizeof(ArgT), alignof(ArgT)>::type buf;
+  std::memcpy(&buf, arg, sizeof(ArgT));
+  reinterpret_cast<void (*)(const ArgT &)>(func)(
+    *reinterpret_cast<const ArgT *>(&buf));
+}
+
+void spawn(
+  task_ptr_t         task,
+  const Dependency * deps,
+  std::size_t        num_deps);
+
+std::size_t register_remote(
+  remote_invoke_t       invoke,
+  void               (* func)(void));
+
+void spawn_remote(
+  dash::global_unit_t   unit,
+  void               (* func)(void),
+  const void          * arg,
+  std::size_t           nbytes);
+
+/**
+ * Wait for the task to be executed, executing other tasks meanwhile.
+ */
+void wait(const Task & task);
+
+/**
+ * Test whether the task has been executed. Executes another task if
+ * it has not, so that polling for a task makes progress if no worker
+ * threads are available.
+ */
+bool test(const Task & task);
+
+/**
+ * Stop the worker threads of this unit after all local tasks have been
+ * executed. Called by \c dash::finalize.
+ */
+void finalize();
+
+template<typename ResultT>
+struct make_task
+{
+  template<typename FuncT>
+  static dash::Future<ResultT> spawn(
+    FuncT            && func,
+    const Dependency  * deps,
+    std::size_t         num_deps)
+  {
+    auto result = std::make_shared<ResultT>();
+    auto task   = std::make_shared<Task>(
+                    [result, f = std::forward<FuncT>(func)]() mutable {
+                      *result = f();
+                    });
+    internal::spawn(task, deps, num_deps);
+    return dash::Future<ResultT>(
+      [task, result]() {
+        internal::wait(*task);
+        return *result;
+      },
+      [task, result](ResultT * value) {
+        if (!internal::test(*task)) {
+          return false;
+        }
+        *value = *result;
+        return true;
+      });
+  }
+};
+
+template<>
+struct make_task<void>
+{
+  template<typename FuncT>
+  static dash::Future<void> spawn(
+    FuncT            && func,
+    const Dependency  * deps,
+    std::size_t         num_deps)
+  {
+    auto task = std::make_shared<Task>(
+                  [f = std::forward<FuncT>(func)]() mutable {
+                    f();
+                  });
+    internal::spawn(task, deps, num_deps);
+    return dash::Future<void>(
+      [task]() {
+        internal::wait(*task);
+      },
+      [task]() {
+        return internal::test(*task);
+      });
+  }
+};
+
+} // namespace internal
+
+/**
+ * Create a task executing \c func once all previously created tasks it
+ * depends on have been executed.
+ *
+ * \param func  The function to execute.
+ * \param deps  Dependencies of the task created with \c dash::tasks::in
+ *              and \c dash::tasks::out.
+ *
+ * \return  A future for the value returned by \c func. Waiting for the
+ *          future executes other tasks until \c func has been executed.
+ *
+ * \ingroup DashTasksConcept
+ */
+template<typename FuncT, typename... DepTs>
+auto async(FuncT && func, DepTs &&... deps)
+  -> dash::Future<decltype(func())>
+{
+  const std::array<Dependency, sizeof...(DepTs)> dep_arr{{
+    std::forward<DepTs>(deps)... }};
+  return internal::make_task<decltype(func())>::spawn(
+           std::forward<FuncT>(func), dep_arr.data(), dep_arr.size());
+}
+
+/**
+ * Register \c func to be executed in tasks created with
+ * \c dash::tasks::async_at.
+ *
+ * Functions are identified by the order of their registration, so all
+ * units have to register the same functions in the same order before
+ * creating remote tasks executing them. Registering a function again has
+ * no effect.
+ *
+ * \ingroup DashTasksConcept
+ */
+template<typename ArgT>
+void register_remote(
+  void                (* func)(const ArgT &))
+{
+  static_assert(std::is_trivially_copyable<ArgT>::value,
+                "Arguments of remote tasks must be trivially copyable");
+  internal::register_remote(
+    &internal::invoke_remote<ArgT>,
+    reinterpret_cast<void (*)(void)>(func));
+}
+
+/**
+ * Create a task executing <tt>func(arg)</tt> on unit \c unit.
+ *
+ * The function has to be registered on all units with
+ * \c dash::tasks::register_remote. The argument is copied bytewise and
+ * its size should not exceed a few hundred bytes.
+ *
+ * Tasks created on remote units are guaranteed to be executed after
+ * the next call of \c dash::tasks::complete returned.
+ *
+ * \ingroup DashTasksConcept
+ */
+template<typename ArgT>
+void async_at(
+  dash::global_unit_t    unit,
+  void                (* func)(const ArgT &),
+  const ArgT           & arg)
+{
+  static_assert(std::is_trivially_copyable<ArgT>::value,
+                "Arguments of remote tasks must be trivially copyable");
+  internal::spawn_remote(
+    unit,
+    reinterpret_cast<void (*)(void)>(func),
+    &arg,
+    sizeof(ArgT));
+}
+
+/**
+ * Execute a single ready task, if any, and process tasks created by other
+ * units.
+ *
+ * \ingroup DashTasksConcept
+ */
+void yield();
+
+/**
+ * Wait until all tasks created on any unit, including tasks created on
+ * remote units, have been executed.
+ *
+ * Collective operation on \c dash::Team::All(), must be called by the
+ * thread that created the first task.
+ *
+ * \ingroup DashTasksConcept
+ */
+void complete();
+
+/**
+ * The number of threads executing tasks on this unit, including the
+ * calling thread.
+ *
+ * \ingroup DashTasksConcept
+ */
+std::size_t num_threads();
+
+} // namespace tasks
+} // namespace dash
+
+#endif // DASH__TASKS_H__INCLUDED
@@ -6,6 +6,7 @@
 #include <dash/Init.h>
 #include <dash/Types.h>
 #include <dash/Exception.h>
+#include <dash/Future.h>
 
 #include <dash/util/Locality.h>
 
@@ -485,6 +486,44 @@ public:
     }
   }
 
+  /**
+   * Non-blocking variant of \c barrier.
+   * The returned future completes once all units in the team have
+   * entered the barrier, allowing local work to overlap with the
+   * synchronization.
+   * Destroying an incomplete future waits for the barrier to complete.
+   */
+  dash::Future<void> barrier_async() const
+  {
+    auto handle = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+    if (!is_null()) {
+      DASH_ASSERT_RETURNS(
+        dart_ibarrier(_dartid, handle.get()),
+        DART_OK);
+    }
+    return dash::Future<void>(
+      // get
+      [handle]() {
+        DASH_ASSERT_RETURNS(
+          dart_wait(handle.get()),
+          DART_OK);
+      },
+      // test
+      [handle]() {
+        int32_t flag;
+        DASH_ASSERT_RETURNS(
+          dart_test(handle.get(), &flag),
+          DART_OK);
+        return (flag != 0);
+      },
+      // destroy
+      [handle]() {
+        DASH_ASSERT_RETURNS(
+          dart_wait(handle.get()),
+          DART_OK);
+      });
+  }
+
   inline team_unit_t myid() const
   {
     return _myid;
@@ -93,6 +93,21 @@ dash::Future<ValueType *> copy_async(
 
 namespace internal {
 
+/**
+ * Creates the handle group collecting the transfers of a copy operation
+ * on first use, so copies of local ranges do not allocate one.
+ */
+inline void lazy_handle_group(
+  dart_handle_group_t & group,
+  size_t                capacity)
+{
+  if (group == DART_HANDLE_GROUP_NULL) {
+    DASH_ASSERT_RETURNS(
+      dart_handle_group_create(capacity, &group),
+      DART_OK);
+  }
+}
+
 // =========================================================================
 // Global to Local
 // =========================================================================
@@ -108,7 +123,7 @@ ValueType * copy_impl(
   GlobInputIt                  in_first,
   GlobInputIt                  in_last,
   ValueType                  * out_first,
-  std::vector<dart_handle_t> & handles)
+  dart_handle_group_t        & group)
 {
   DASH_LOG_TRACE("dash::copy_impl()",
                  "in_first:",  in_first.pos(),
@@ -147,19 +162,17 @@ ValueType * copy_impl(
                     "get elements:",   num_elem_total);
     auto cur_in_first  = g_in_first;
     auto cur_out_first = out_first;
-    dart_handle_t handle;
-    dash::internal::get_handle(
+    dash::internal::lazy_handle_group(group, 1);
+    dash::internal::get_group(
       cur_in_first.dart_gptr(),
       cur_out_first,
       num_elem_total,
-      &handle);
-    if (handle != DART_HANDLE_NULL) {
-      handles.push_back(handle);
-    }
+      group);
     num_elem_copied = num_elem_total;
   } else {
     // Input range is spread over several remote units:
     DASH_LOG_TRACE("dash::copy_impl", "input range spans multiple units");
+    dash::internal::lazy_handle_group(group, pattern.num_units());
     //
     // Copy elements from every unit:
     //
@@ -198,12 +211,8 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto dest_ptr = out_first + num_elem_copied;
       auto src_gptr = cur_in_first.dart_gptr();
-      dart_handle_t handle;
-      dash::internal::get_handle(src_gptr, dest_ptr, num_copy_elem, &handle);
+      dash::internal::get_group(src_gptr, dest_ptr, num_copy_elem, group);
       num_elem_copied += num_copy_elem;
-      if (handle != DART_HANDLE_NULL) {
-        handles.push_back(handle);
-      }
     }
   }
 
@@ -227,7 +236,7 @@ GlobOutputIt copy_impl(
   ValueType                  * in_first,
   ValueType                  * in_last,
   GlobOutputIt                 out_first,
-  std::vector<dart_handle_t> & handles)
+  dart_handle_group_t        & group)
 {
   DASH_LOG_TRACE("dash::copy_impl()",
                  "l_in_first:",  in_first,
@@ -235,15 +244,12 @@ GlobOutputIt copy_impl(
                  "g_out_first:", out_first);
 
   auto num_elements = std::distance(in_first, in_last);
-  dart_handle_t handle;
-  dash::internal::put_handle(
+  dash::internal::lazy_handle_group(group, 1);
+  dash::internal::put_group(
     out_first.dart_gptr(),
     in_first,
     num_elements,
-    &handle);
-  if (handle != DART_HANDLE_NULL) {
-    handles.push_back(handle);
-  }
+    group);
 
   auto out_last = out_first + num_elements;
   DASH_LOG_TRACE("dash::copy_impl >",
@@ -330,7 +336,7 @@ dash::Future<ValueType *> copy_async(
     return dash::Future<ValueType *>(out_last);
   }
 
-  auto handles = std::make_shared<std::vector<dart_handle_t>>();
+  dart_handle_group_t group = DART_HANDLE_GROUP_NULL;
 
   DASH_LOG_TRACE("dash::copy_async", "local range:",
                  li_range_in.begin,
@@ -380,7 +386,7 @@ dash::Future<ValueType *> copy_async(
       dash::internal::copy_impl(g_in_first,
                                 g_l_in_first,
                                 dest_first,
-                                *handles);
+                                group);
       // Advance output pointers:
       out_last   += num_prelocal_elem;
       dest_first  = out_last;
@@ -403,7 +409,7 @@ dash::Future<ValueType *> copy_async(
       dash::internal::copy_impl(g_l_in_last,
                                 g_in_last,
                                 dest_first,
-                                *handles);
+                                group);
       out_last += num_postlocal_elem;
     }
     //
@@ -452,12 +458,12 @@ dash::Future<ValueType *> copy_async(
     dash::internal::copy_impl(in_first,
                               in_last,
                               dest_first,
-                              *handles);
+                              group);
     out_last = out_first + total_copy_elem;
   }
   DASH_LOG_TRACE("dash::copy_async", "preparing future");
-  if (handles->empty()) {
-    DASH_LOG_TRACE("dash::copy_async >", "finished (no pending handles), ",
+  if (group == DART_HANDLE_GROUP_NULL) {
+    DASH_LOG_TRACE("dash::copy_async >", "finished (no pending transfers), ",
                    "out_last:", out_last);
     return dash::Future<ValueType *>(out_last);
   }
@@ -467,19 +473,15 @@ dash::Future<ValueType *> copy_async(
       // Wait for all get requests to complete:
       ValueType * _out = out_last;
       DASH_LOG_TRACE("dash::copy_async_impl [Future]()",
-                    "  wait for", handles->size(), "async get request");
+                    "  wait for async get requests");
       DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  _out:", _out);
-      if (!handles->empty()) {
-        if (dart_waitall_local(handles->data(), handles->size())
-            != DART_OK) {
-          DASH_LOG_ERROR("dash::copy_async_impl [Future]",
-                        "  dart_waitall_local failed");
-          DASH_THROW(
-            dash::exception::RuntimeError,
-            "dash::copy_async_impl [Future]: dart_waitall_local failed");
-        }
-      } else {
-        DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  No pending handles");
+      if (dart_handle_group_wait_local(group) != DART_OK) {
+        DASH_LOG_ERROR("dash::copy_async_impl [Future]",
+                      "  dart_handle_group_wait_local failed");
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::copy_async_impl [Future]: "
+          "dart_handle_group_wait_local failed");
       }
       DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
                     "  async requests completed, _out:", _out);
@@ -490,20 +492,17 @@ dash::Future<ValueType *> copy_async(
       int32_t flag;
       DASH_ASSERT_RETURNS(
         DART_OK,
-        dart_testall_local(handles->data(), handles->size(), &flag));
+        dart_handle_group_test_local(group, &flag));
       if (flag) {
-        handles->clear();
         *out = out_last;
       }
       return (flag != 0);
     },
     // destroy
     [=]() mutable {
-      for (auto& handle : *handles) {
-        DASH_ASSERT_RETURNS(
-          DART_OK,
-          dart_handle_free(&handle));
-      }
+      DASH_ASSERT_RETURNS(
+        DART_OK,
+        dart_handle_group_destroy(&group));
     }
   );
 
@@ -573,7 +572,7 @@ ValueType * copy(
     return out_last;
   }
 
-  std::vector<dart_handle_t> handles;
+  dart_handle_group_t group = DART_HANDLE_GROUP_NULL;
 
   DASH_LOG_TRACE("dash::copy", "local range:",
                  li_range_in.begin,
@@ -628,7 +627,7 @@ ValueType * copy(
       out_last = dash::internal::copy_impl(g_in_first,
                                            g_l_in_first,
                                            dest_first,
-                                           handles);
+                                           group);
       // Advance output pointers:
       dest_first = out_last;
     }
@@ -687,7 +686,7 @@ ValueType * copy(
       out_last = dash::internal::copy_impl(g_l_in_last,
                                            g_in_last,
                                            dest_first,
-                                           handles);
+                                           group);
     }
   } else {
     DASH_LOG_TRACE("dash::copy", "no local subrange");
@@ -695,13 +694,13 @@ ValueType * copy(
     out_last = dash::internal::copy_impl(in_first,
                                          in_last,
                                          dest_first,
-                                         handles);
+                                         group);
   }
 
-  if (!handles.empty()) {
-    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
-                  "num_handles: ", handles.size());
-    dart_waitall_local(handles.data(), handles.size());
+  if (group != DART_HANDLE_GROUP_NULL) {
+    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete");
+    dart_handle_group_wait_local(group);
+    dart_handle_group_destroy(&group);
   }
 
   DASH_LOG_TRACE("dash::copy >", "finished,",
@@ -727,36 +726,30 @@ dash::Future<GlobOutputIt> copy_async(
   ValueType    * in_last,
   GlobOutputIt   out_first)
 {
-  auto handles  = std::make_shared<std::vector<dart_handle_t>>();
+  dart_handle_group_t group = DART_HANDLE_GROUP_NULL;
   auto out_last = dash::internal::copy_impl(in_first,
                                             in_last,
                                             out_first,
-                                            *handles);
+                                            group);
 
-  if (handles->empty()) {
+  if (group == DART_HANDLE_GROUP_NULL) {
     return dash::Future<GlobOutputIt>(out_last);
   }
   dash::Future<GlobOutputIt> fut_result(
     // get
     [=]() mutable {
-      // Wait for all get requests to complete:
+      // Wait for all put requests to complete:
       GlobOutputIt _out = out_last;
       DASH_LOG_TRACE("dash::copy_async [Future]()",
-                    "  wait for", handles->size(), "async put request");
+                    "  wait for async put requests");
       DASH_LOG_TRACE("dash::copy_async [Future]", "  _out:", _out);
-      if (!handles->empty()) {
-        if (dart_waitall(handles->data(), handles->size())
-            != DART_OK) {
-          DASH_LOG_ERROR("dash::copy_async [Future]",
-                        "  dart_waitall failed");
-          DASH_THROW(
-            dash::exception::RuntimeError,
-            "dash::copy_async [Future]: dart_waitall failed");
-        }
-      } else {
-        DASH_LOG_TRACE("dash::copy_async [Future]", "  No pending handles");
+      if (dart_handle_group_wait(group) != DART_OK) {
+        DASH_LOG_ERROR("dash::copy_async [Future]",
+                      "  dart_handle_group_wait failed");
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::copy_async [Future]: dart_handle_group_wait failed");
       }
-      handles->clear();
       DASH_LOG_TRACE("dash::copy_async [Future] >",
                     "  async requests completed, _out:", _out);
       return _out;
@@ -766,20 +759,17 @@ dash::Future<GlobOutputIt> copy_async(
       int32_t flag;
       DASH_ASSERT_RETURNS(
         DART_OK,
-        dart_testall(handles->data(), handles->size(), &flag));
+        dart_handle_group_test(group, &flag));
       if (flag) {
-        handles->clear();
         *out = out_last;
       }
       return (flag != 0);
     },
     // destroy
     [=]() mutable {
-      for (auto& handle : *handles) {
-        DASH_ASSERT_RETURNS(
-          DART_OK,
-          dart_handle_free(&handle));
-      }
+      DASH_ASSERT_RETURNS(
+        DART_OK,
+        dart_handle_group_destroy(&group));
     }
   );
   return fut_result;
@@ -815,8 +805,8 @@ GlobOutputIt copy(
   DASH_LOG_TRACE_VAR("dash::copy", li_range_out.end);
   // Number of elements in the local subrange:
   auto num_local_elem     = li_range_out.end - li_range_out.begin;
-  // handles to wait on at the end
-  std::vector<dart_handle_t> handles;
+  // transfers to wait on at the end
+  dart_handle_group_t group = DART_HANDLE_GROUP_NULL;
   // Check if part of the output range is local:
   if (num_local_elem > 0) {
     // Part of the output range is local
@@ -857,7 +847,7 @@ GlobOutputIt copy(
                    in_first,
                    in_first + l_elem_offset,
                    out_first,
-                   handles);
+                   group);
     }
     // Copy to remote elements succeeding the local subrange:
     if (g_l_offset_end < out_h_last.pos()) {
@@ -866,7 +856,7 @@ GlobOutputIt copy(
                    in_first + l_elem_offset + num_local_elem,
                    in_last,
                    out_first + num_local_elem,
-                   handles);
+                   group);
     }
   } else {
     // All elements in output range are remote
@@ -875,13 +865,13 @@ GlobOutputIt copy(
                  in_first,
                  in_last,
                  out_first,
-                 handles);
+                 group);
   }
 
-  if (!handles.empty()) {
-    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
-                  "num_handles: ", handles.size());
-    dart_waitall(handles.data(), handles.size());
+  if (group != DART_HANDLE_GROUP_NULL) {
+    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete");
+    dart_handle_group_wait(group);
+    dart_handle_group_destroy(&group);
   }
 
   return out_last;
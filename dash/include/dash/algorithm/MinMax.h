@@ -4,6 +4,7 @@
 #include <dash/internal/Config.h>
 
 #include <dash/Allocator.h>
+#include <dash/Future.h>
 
 #include <dash/algorithm/LocalRange.h>
 
@@ -16,6 +17,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
@@ -138,56 +140,41 @@ const ElementType * min_element(
   return ::std::min_element(l_range_begin, l_range_end, compare);
 }
 
+namespace internal {
+
 /**
- * Finds an iterator pointing to the element with the smallest value in
- * the range [first,last).
- *
- * \return      An iterator to the first occurrence of the smallest value
- *              in the range, or \c last if the range is empty.
- *
- * \tparam      ElementType  Type of the elements in the sequence
- * \tparam      Compare      Binary comparison function with signature
- *                           \c bool (const TypeA &a, const TypeB &b)
- *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
- *
- * \ingroup     DashAlgorithms
+ * Local minimum of a unit as exchanged in \c dash::min_element.
+ */
+template <typename ValueType, typename IndexType>
+struct min_element_local_min {
+  ValueType value;
+  IndexType g_index;
+};
+
+/**
+ * Finds the minimum element in the local part of the global range
+ * [first,last).
+ * The global index of the result is -1 if no local element is in range.
  */
 template <
     typename GlobInputIt,
-    class Compare = std::less<
-        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
-GlobInputIt min_element(
-    /// Iterator to the initial position in the sequence
-    const typename std::enable_if<
-        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
-        GlobInputIt>::type &first,
-    /// Iterator to the final position in the sequence
+    class    Compare >
+min_element_local_min<
+  typename std::decay<
+    typename dash::iterator_traits<GlobInputIt>::value_type>::type,
+  typename GlobInputIt::pattern_type::index_type >
+min_element_local(
+    const GlobInputIt &first,
     const GlobInputIt &last,
-    /// Element comparison function, defaults to std::less
-    Compare compare = Compare())
+    Compare            compare)
 {
   typedef typename GlobInputIt::pattern_type     pattern_t;
   typedef typename pattern_t::index_type         index_t;
   typedef typename std::decay<
       typename dash::iterator_traits<GlobInputIt>::value_type>::type value_t;
 
-  // return last for empty array
-  if (first == last) {
-    DASH_LOG_DEBUG("dash::min_element >",
-                   "empty range, returning last", last);
-    return last;
-  }
-
-  dash::util::Trace trace("min_element");
-
   auto & pattern = first.pattern();
   auto & team    = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
-  // Global position of end element in range:
-  auto    gi_last            = last.gpos();
   // Find the local min. element in parallel
   // Get local address range between global iterators:
   auto    local_idx_range    = dash::local_index_range(first, last);
@@ -199,8 +186,6 @@ GlobInputIt min_element(
     // local range is empty
     DASH_LOG_DEBUG("dash::min_element", "local range empty");
   } else {
-    trace.enter_state("local");
-
     // Pointer to first element in local memory:
     auto *lbegin = dash::local_begin(
         static_cast<typename GlobInputIt::const_pointer>(first), team.myid());
@@ -216,50 +201,38 @@ GlobInputIt min_element(
       // Offset of local minimum in local memory:
       l_idx_lmin = lmin - lbegin;
     }
-
-    trace.exit_state("local");
   }
   DASH_LOG_TRACE("dash::min_element",
                  "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
-
-  typedef struct {
-    value_t  value;
-    index_t  g_index;
-  } local_min_t;
-
-  std::vector<local_min_t> local_min_values(team.size());
 
   // Set global index of local minimum to -1 if no local minimum has been
   // found:
-  local_min_t local_min;
+  min_element_local_min<value_t, index_t> local_min;
   local_min.value   = l_idx_lmin < 0
                       ? value_t()
                       : *lmin;
   local_min.g_index = l_idx_lmin < 0
                       ? -1
                       : pattern.global(l_idx_lmin);
+  return local_min;
+}
 
-  DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
-                 "value:",   local_min.value,
-                 "g.index:", local_min.g_index, "}");
-
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
-  DASH_ASSERT_RETURNS(
-    dart_allgather(
-      &local_min,
-      local_min_values.data(),
-      sizeof(local_min_t),
-      DART_TYPE_BYTE,
-      team.dart_id()),
-    DART_OK);
-  trace.exit_state("allgather");
+/**
+ * Selects the global minimum from the local minima gathered from all
+ * units and converts it to a global iterator.
+ */
+template <
+    typename GlobInputIt,
+    typename LocalMinT,
+    class    Compare >
+GlobInputIt min_element_select(
+    const GlobInputIt             &first,
+    const GlobInputIt             &last,
+    const std::vector<LocalMinT>  &local_min_values,
+    Compare                        compare)
+{
+  typedef typename std::decay<
+      typename dash::iterator_traits<GlobInputIt>::value_type>::type value_t;
 
 #ifdef DASH_ENABLE_LOGGING
   for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
@@ -274,8 +247,8 @@ GlobInputIt min_element(
   auto gmin_elem_it  = ::std::min_element(
                            local_min_values.begin(),
                            local_min_values.end(),
-                           [&](const local_min_t & a,
-                               const local_min_t & b) {
+                           [&](const LocalMinT & a,
+                               const LocalMinT & b) {
                              // Ignore elements with global index -1 (no
                              // element found):
                              return (b.g_index < 0 ||
@@ -296,7 +269,8 @@ GlobInputIt min_element(
                  "global idx:", gi_minimum);
 
   DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
-  if (gi_minimum < 0 || gi_minimum == gi_last) {
+  // Global position of end element in range:
+  if (gi_minimum < 0 || gi_minimum == last.gpos()) {
     DASH_LOG_DEBUG_VAR("dash::min_element >", last);
     return last;
   }
@@ -310,6 +284,174 @@ GlobInputIt min_element(
   return minimum;
 }
 
+} // namespace internal
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename GlobInputIt,
+    class Compare = std::less<
+        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
+GlobInputIt min_element(
+    /// Iterator to the initial position in the sequence
+    const typename std::enable_if<
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+        GlobInputIt>::type &first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt &last,
+    /// Element comparison function, defaults to std::less
+    Compare compare = Compare())
+{
+  // return last for empty array
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::min_element >",
+                   "empty range, returning last", last);
+    return last;
+  }
+
+  dash::util::Trace trace("min_element");
+
+  auto & team    = first.pattern().team();
+
+  trace.enter_state("local");
+  auto local_min = dash::internal::min_element_local(first, last, compare);
+  trace.exit_state("local");
+
+  DASH_LOG_TRACE("dash::min_element",
+                 "waiting for local min of other units");
+
+  trace.enter_state("barrier");
+  team.barrier();
+  trace.exit_state("barrier");
+
+  DASH_LOG_DEBUG("dash::min_element()",
+                 "allocate minarr, size", team.size());
+  std::vector<decltype(local_min)> local_min_values(team.size());
+
+  DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
+                 "value:",   local_min.value,
+                 "g.index:", local_min.g_index, "}");
+
+  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
+  trace.enter_state("allgather");
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &local_min,
+      local_min_values.data(),
+      sizeof(local_min),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  trace.exit_state("allgather");
+
+  return dash::internal::min_element_select(
+           first, last, local_min_values, compare);
+}
+
+/**
+ * Non-blocking variant of \ref dash::min_element on global ranges.
+ *
+ * The local minimum is determined before this function returns, the
+ * exchange of local minima between units is started but not waited for.
+ * The returned future yields the same iterator as \ref dash::min_element
+ * and allows local work to overlap with the collective operation.
+ * The range must not be modified before the future has completed.
+ *
+ * \return      A future to an iterator to the first occurrence of the
+ *              smallest value in the range, or \c last if the range is
+ *              empty.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename GlobInputIt,
+    class Compare = std::less<
+        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
+dash::Future<GlobInputIt> min_element_async(
+    /// Iterator to the initial position in the sequence
+    const typename std::enable_if<
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+        GlobInputIt>::type &first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt &last,
+    /// Element comparison function, defaults to std::less
+    Compare compare = Compare())
+{
+  // return last for empty array
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::min_element_async >",
+                   "empty range, returning last", last);
+    return dash::Future<GlobInputIt>(last);
+  }
+
+  auto & team      = first.pattern().team();
+  auto   local_min = dash::internal::min_element_local(first, last, compare);
+
+  typedef decltype(local_min) local_min_t;
+
+  struct state_t {
+    local_min_t              local_min;
+    std::vector<local_min_t> local_min_values;
+    dart_handle_t            handle = DART_HANDLE_NULL;
+
+    ~state_t() {
+      // the collective has to complete before its buffers are released
+      dart_wait(&handle);
+    }
+  };
+
+  auto state = std::make_shared<state_t>();
+  state->local_min = local_min;
+  state->local_min_values.resize(team.size());
+
+  DASH_LOG_TRACE("dash::min_element_async", "dart_iallgather()");
+  DASH_ASSERT_RETURNS(
+    dart_iallgather(
+      &state->local_min,
+      state->local_min_values.data(),
+      sizeof(local_min_t),
+      DART_TYPE_BYTE,
+      team.dart_id(),
+      &state->handle),
+    DART_OK);
+
+  return dash::Future<GlobInputIt>(
+    // get
+    [=]() {
+      DASH_ASSERT_RETURNS(
+        dart_wait(&state->handle),
+        DART_OK);
+      return dash::internal::min_element_select(
+               first, last, state->local_min_values, compare);
+    },
+    // test
+    [=](GlobInputIt * result) {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_test(&state->handle, &flag),
+        DART_OK);
+      if (flag) {
+        *result = dash::internal::min_element_select(
+                    first, last, state->local_min_values, compare);
+      }
+      return (flag != 0);
+    });
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
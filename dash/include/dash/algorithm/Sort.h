@@ -12,7 +12,6 @@
 #include <dash/Meta.h>
 #include <dash/dart/if/dart.h>
 
-#include <dash/algorithm/Copy.h>
 #include <dash/algorithm/LocalRange.h>
 
 #include <dash/internal/Logging.h>
@@ -134,8 +133,6 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto const  nunits = team.size();
   auto const  myid   = team.myid();
 
-  auto const unit_at_begin = pattern.unit_at(begin.pos());
-
   // local distance
   auto const l_range = dash::local_index_range(begin, end);
 
@@ -152,20 +149,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   std::sort(lbegin, lend, sort_comp);
   trace.exit_state("1:initial_local_sort");
 
-  trace.enter_state("2:init_temporary_global_data");
-
-  using array_t = dash::Array<std::size_t>;
-
-  std::size_t gsize = nunits * NLT_NLE_BLOCK * 2;
-
-  // implicit barrier...
-  array_t g_partition_data(nunits * nunits * 3, dash::BLOCKED, team);
-  std::uninitialized_fill(
-      g_partition_data.lbegin(), g_partition_data.lend(), 0);
-
-  trace.exit_state("2:init_temporary_global_data");
-
-  trace.enter_state("3:find_global_min_max");
+  trace.enter_state("2:find_global_min_max");
 
   // Temporary local buffer (sorted);
   std::vector<value_type> const lcopy(lbegin, lend);
@@ -173,7 +157,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto const min_max = detail::find_global_min_max(
       std::begin(lcopy), std::end(lcopy), team.dart_id(), sortable_hash);
 
-  trace.exit_state("3:find_global_min_max");
+  trace.exit_state("2:find_global_min_max");
 
   DASH_LOG_TRACE_VAR("global minimum in range", min_max.first);
   DASH_LOG_TRACE_VAR("global maximum in range", min_max.second);
@@ -184,7 +168,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     return;
   }
 
-  trace.enter_state("4:init_temporary_local_data");
+  trace.enter_state("3:init_temporary_local_data");
 
   auto const p_unit_info =
       detail::psort__find_partition_borders(pattern, begin, end);
@@ -238,9 +222,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     return;
   }
 
-  trace.exit_state("4:init_temporary_local_data");
+  trace.exit_state("3:init_temporary_local_data");
 
-  trace.enter_state("5:find_global_partition_borders");
+  trace.enter_state("4:find_global_partition_borders");
 
   size_t iter = 0;
 
@@ -286,11 +270,11 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         p_unit_info, splitters, valid_partitions, p_borders, global_histo);
   } while (!done);
 
-  trace.exit_state("5:find_global_partition_borders");
+  trace.exit_state("4:find_global_partition_borders");
 
   DASH_LOG_TRACE_VAR("partition borders found after N iterations", iter);
 
-  trace.enter_state("6:final_local_histogram");
+  trace.enter_state("5:final_local_histogram");
 
   /* How many elements are less than P
    * or less than equals P */
@@ -301,153 +285,107 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       std::begin(lcopy),
       std::end(lcopy),
       sortable_hash);
-  trace.exit_state("6:final_local_histogram");
+  trace.exit_state("5:final_local_histogram");
 
   DASH_LOG_TRACE_RANGE("final splitters", splitters.begin(), splitters.end());
 
   detail::trace_local_histo("final histograms", histograms);
 
-  trace.enter_state("7:transpose_local_histograms (all-to-all)");
+  trace.enter_state("6:transpose_local_histograms (all-to-all)");
 
-  if (n_l_elem > 0) {
-    // TODO(kowalewski): minimize communication to copy only until the last
-    // valid border
-    /*
-     * Transpose (Shuffle) the final histograms to communicate
-     * the partition distribution
-     */
-
-    dash::team_unit_t transposed_unit{0};
-    for (auto it = std::begin(histograms); it != std::end(histograms);
-         it += NLT_NLE_BLOCK, ++transposed_unit) {
-      auto const& nlt_val = *it;
-      auto const& nle_val = *std::next(it);
-      if (transposed_unit != myid) {
-        auto const offset = transposed_unit * g_partition_data.lsize() + myid;
-        // We communicate only non-zero values
-        if (nlt_val > 0) {
-          g_partition_data.async[offset + IDX_DIST(nunits)].set(&(nlt_val));
-        }
-
-        if (nle_val > 0) {
-          g_partition_data.async[offset + IDX_SUPP(nunits)].set(&(nle_val));
-        }
-      }
-      else {
-        g_partition_data.local[myid + IDX_DIST(nunits)] = nlt_val;
-        g_partition_data.local[myid + IDX_SUPP(nunits)] = nle_val;
-      }
+  /*
+   * Transpose (Shuffle) the final histograms to communicate
+   * the partition distribution: unit u receives the number of elements
+   * less than / less than or equal to its splitter from every unit.
+   * Units without local elements contribute zero-valued histograms.
+   */
+  std::vector<size_t> l_partition_data(nunits * NLT_NLE_BLOCK, 0);
+
+  {
+    std::vector<size_t> transposed_histo(nunits * NLT_NLE_BLOCK, 0);
+
+    DASH_ASSERT_RETURNS(
+        dart_alltoall(
+            histograms.data(),
+            transposed_histo.data(),
+            NLT_NLE_BLOCK,
+            dash::dart_datatype<size_t>::value,
+            team.dart_id()),
+        DART_OK);
+
+    for (std::size_t unit = 0; unit < nunits; ++unit) {
+      l_partition_data[IDX_DIST(nunits) + unit] =
+          transposed_histo[unit * NLT_NLE_BLOCK];
+      l_partition_data[IDX_SUPP(nunits) + unit] =
+          transposed_histo[unit * NLT_NLE_BLOCK + 1];
     }
-    // complete outstanding requests...
-    g_partition_data.async.flush();
   }
-  trace.exit_state("7:transpose_local_histograms (all-to-all)");
 
-  trace.enter_state("8:barrier");
-  team.barrier();
-  trace.exit_state("8:barrier");
+  trace.exit_state("6:transpose_local_histograms (all-to-all)");
 
   DASH_LOG_TRACE_RANGE(
       "initial partition distribution:",
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
+      std::next(l_partition_data.begin(), IDX_DIST(nunits)),
+      std::next(l_partition_data.begin(), IDX_DIST(nunits) + nunits));
 
   DASH_LOG_TRACE_RANGE(
       "initial partition supply:",
-      std::next(g_partition_data.lbegin(), IDX_SUPP(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_SUPP(nunits) + nunits));
+      std::next(l_partition_data.begin(), IDX_SUPP(nunits)),
+      std::next(l_partition_data.begin(), IDX_SUPP(nunits) + nunits));
 
   /* Calculate final distribution per partition. Each unit calculates their
    * local distribution independently.
    * All accesses are only to local memory
    */
 
-  trace.enter_state("9:calc_final_partition_dist");
+  trace.enter_state("7:calc_final_partition_dist");
 
   detail::psort__calc_final_partition_dist(
-      acc_partition_count, g_partition_data.local);
+      acc_partition_count, l_partition_data, myid);
 
   DASH_LOG_TRACE_RANGE(
       "final partition distribution",
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
-
-  // Reset local elements to 0 since the following matrix transpose
-  // communicates only non-zero values and writes to exactly these offsets.
-  std::fill(
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits)]),
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits) + nunits]),
-      0);
+      std::next(l_partition_data.begin(), IDX_DIST(nunits)),
+      std::next(l_partition_data.begin(), IDX_DIST(nunits) + nunits));
 
-  trace.exit_state("9:calc_final_partition_dist");
+  trace.exit_state("7:calc_final_partition_dist");
 
-  trace.enter_state("10:barrier");
-  team.barrier();
-  trace.exit_state("10:barrier");
-
-  trace.enter_state("11:transpose_final_partition_dist (all-to-all)");
+  trace.enter_state("8:transpose_final_partition_dist (all-to-all)");
   /*
    * Transpose the final distribution again to obtain the end offsets
    */
-  dash::team_unit_t unit{0};
-  auto const        last = static_cast<dash::team_unit_t>(nunits);
-
-  for (; unit < last; ++unit) {
-    if (g_partition_data.local[IDX_DIST(nunits) + unit] == 0) {
-      continue;
-    }
+  std::vector<size_t> target_count(nunits, 0);
 
-    if (unit != myid) {
-      // We communicate only non-zero values
-      auto const offset = unit * g_partition_data.lsize() + myid;
-      g_partition_data.async[offset + IDX_TARGET_COUNT(nunits)].set(
-          &(g_partition_data.local[IDX_DIST(nunits) + unit]));
-    }
-    else {
-      g_partition_data.local[IDX_TARGET_COUNT(nunits) + myid] =
-          g_partition_data.local[IDX_DIST(nunits) + unit];
-    }
-  }
-
-  g_partition_data.async.flush();
-
-  trace.exit_state("11:transpose_final_partition_dist (all-to-all)");
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          std::next(l_partition_data.data(), IDX_DIST(nunits)),
+          target_count.data(),
+          1,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
 
-  trace.enter_state("12:barrier");
-  team.barrier();
-  trace.exit_state("12:barrier");
+  trace.exit_state("8:transpose_final_partition_dist (all-to-all)");
 
   DASH_LOG_TRACE_RANGE(
-      "final target count",
-      std::next(g_partition_data.lbegin(), IDX_TARGET_COUNT(nunits)),
-      std::next(
-          g_partition_data.lbegin(), IDX_TARGET_COUNT(nunits) + nunits));
+      "final target count", target_count.begin(), target_count.end());
 
-  trace.enter_state("13:calc_final_send_count");
+  trace.enter_state("9:calc_final_send_count");
 
-  std::vector<std::size_t> l_send_displs(nunits, 0);
+  std::vector<std::size_t> send_count(nunits, 0);
+  std::vector<std::size_t> send_displs(nunits, 0);
 
   if (n_l_elem > 0) {
-    auto const* l_target_count =
-        &(g_partition_data.local[IDX_TARGET_COUNT(nunits)]);
-    auto* l_send_count = &(g_partition_data.local[IDX_SEND_COUNT(nunits)]);
-
     detail::psort__calc_send_count(
-        p_borders, valid_partitions, l_target_count, l_send_count);
+        p_borders, valid_partitions, target_count.data(), send_count.data());
 
     // exclusive scan using partial sum
     std::partial_sum(
-        l_send_count,
-        std::next(l_send_count, nunits - 1),
-        std::next(std::begin(l_send_displs)),
+        send_count.begin(),
+        std::prev(send_count.end()),
+        std::next(send_displs.begin()),
         std::plus<size_t>());
   }
-  else {
-    std::fill(
-        std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-        std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits) + nunits),
-        0);
-  }
 
 #if defined(DASH_ENABLE_ASSERTIONS) && defined(DASH_ENABLE_TRACE_LOGGING)
   {
@@ -455,7 +393,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
     DASH_ASSERT_RETURNS(
         dart_allreduce(
-            std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
+            send_count.data(),
             chksum.data(),
             nunits,
             dart_datatype<size_t>::value,
@@ -470,100 +408,88 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   }
 #endif
 
-  DASH_LOG_TRACE_RANGE(
-      "send count",
-      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits) + nunits));
+  DASH_LOG_TRACE_RANGE("send count", send_count.begin(), send_count.end());
 
   DASH_LOG_TRACE_RANGE(
-      "send displs", l_send_displs.begin(), l_send_displs.end());
+      "send displs", send_displs.begin(), send_displs.end());
 
-  trace.exit_state("13:calc_final_send_count");
+  trace.exit_state("9:calc_final_send_count");
 
-  trace.enter_state("14:barrier");
-  team.barrier();
-  trace.exit_state("14:barrier");
+  trace.enter_state("10:calc_recv_count (all-to-all)");
 
+  std::vector<size_t> recv_count(nunits, 0);
 
-  trace.enter_state("15:calc_final_target_displs");
+  DASH_ASSERT_RETURNS(
+  dart_alltoall(
+      // send buffer
+      send_count.data(),
+      // receive buffer
+      recv_count.data(),
+      // we send / receive 1 element to / from each process
+      1,
+      // dtype
+      dash::dart_datatype<size_t>::value,
+      // teamid
+      team.dart_id()), DART_OK);
 
-  if (n_l_elem > 0) {
-    detail::psort__calc_target_displs(
-        p_borders, valid_partitions, g_partition_data);
-  }
+  DASH_LOG_TRACE_RANGE(
+      "recv count", std::begin(recv_count), std::end(recv_count));
 
-  trace.exit_state("15:calc_final_target_displs");
+  // calculate the prefix sum among all receive counts to find the offsets
+  // of received sequences, the last element is the total number of
+  // received elements
+  std::vector<size_t> recv_count_psum;
+  recv_count_psum.reserve(nunits + 1);
+  recv_count_psum.emplace_back(0);
 
-  trace.enter_state("16:barrier");
-  team.barrier();
-  trace.exit_state("16:barrier");
+  std::partial_sum(
+      std::begin(recv_count),
+      std::end(recv_count),
+      std::back_inserter(recv_count_psum));
 
   DASH_LOG_TRACE_RANGE(
-      "target displs",
-      &(g_partition_data.local[IDX_TARGET_DISP(nunits)]),
-      &(g_partition_data.local[IDX_TARGET_DISP(nunits) + nunits]));
-
-  trace.enter_state("17:exchange_data (all-to-all)");
-
-  std::vector<dash::Future<iter_type> > async_copies{};
-  async_copies.reserve(p_unit_info.valid_remote_partitions.size());
+      "recv count prefix sum",
+      std::begin(recv_count_psum),
+      std::end(recv_count_psum));
 
-  auto const l_partition_data = g_partition_data.local;
+  DASH_ASSERT_EQ(
+      recv_count_psum.back(),
+      n_l_elem,
+      "receive count must match the capacity of the unit");
 
-  auto const get_send_info = [l_partition_data, &l_send_displs, nunits](
-                                 dash::default_index_t const p_idx) {
-    auto const send_count = l_partition_data[p_idx + IDX_SEND_COUNT(nunits)];
-    auto const target_disp =
-        l_partition_data[p_idx + IDX_TARGET_DISP(nunits)];
-    auto const send_disp = l_send_displs[p_idx];
-    return std::make_tuple(send_count, send_disp, target_disp);
-  };
+  trace.exit_state("10:calc_recv_count (all-to-all)");
 
-  std::size_t send_count, send_disp, target_disp;
-
-  for (auto const& unit : p_unit_info.valid_remote_partitions) {
-    std::tie(send_count, send_disp, target_disp) = get_send_info(unit);
-
-    // Get a global iterator to the first local element of a unit within the
-    // range to be sorted [begin, end)
-    //
-    iter_type it_copy =
-        (unit == unit_at_begin)
-            ?
-            /* If we are the unit at the beginning of the global range simply
-               return begin */
-            begin
-            :
-            /* Otherwise construct an global iterator pointing the first local
-               element from the correspoding unit */
-            iter_type{&(begin.globmem()),
-                      pattern,
-                      pattern.global_index(
-                          static_cast<dash::team_unit_t>(unit), {})};
-
-    auto&& fut = dash::copy_async(
-        &(*(lcopy.begin() + send_disp)),
-        &(*(lcopy.begin() + send_disp + send_count)),
-        it_copy + target_disp);
-
-    async_copies.emplace_back(std::move(fut));
-  }
+  trace.enter_state("11:exchange_data (all-to-all)");
 
-  std::tie(send_count, send_disp, target_disp) = get_send_info(myid);
+  {
+    // Counts and displacements in units of the DART storage type of the
+    // elements, which are bytes for non-arithmetic value types
+    auto const to_storage = [](std::vector<size_t>& v) {
+      for (auto& n : v) {
+        n = dash::dart_storage<value_type>(n).nelem;
+      }
+    };
+    std::vector<size_t> recv_displs(
+        recv_count_psum.begin(), std::prev(recv_count_psum.end()));
+    to_storage(send_count);
+    to_storage(send_displs);
+    to_storage(recv_count);
+    to_storage(recv_displs);
 
-  if (send_count) {
-    std::copy(
-        std::next(std::begin(lcopy), send_disp),
-        std::next(std::begin(lcopy), send_disp + send_count),
-        std::next(lbegin, target_disp));
+    DASH_ASSERT_RETURNS(
+        dart_alltoallv(
+            lcopy.data(),
+            send_count.data(),
+            send_displs.data(),
+            dash::dart_storage<value_type>::dtype,
+            lbegin,
+            recv_count.data(),
+            recv_displs.data(),
+            team.dart_id()),
+        DART_OK);
   }
 
-  std::for_each(
-      std::begin(async_copies),
-      std::end(async_copies),
-      [](dash::Future<iter_type>& fut) { fut.wait(); });
-
-  trace.exit_state("17:exchange_data (all-to-all)");
+  trace.exit_state("11:exchange_data (all-to-all)");
 
   /* NOTE: While merging locally sorted sequences is faster than another
    * heavy-weight sort it comes at a cost. std::inplace_merge allocates a
@@ -582,59 +508,17 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
    */
 
 #if (__DASH_SORT__FINAL_STEP_STRATEGY == __DASH_SORT__FINAL_STEP_BY_SORT)
-  trace.enter_state("18:barrier");
-  team.barrier();
-  trace.exit_state("18:barrier");
-
-  trace.enter_state("19:final_local_sort");
+  trace.enter_state("12:final_local_sort");
   std::sort(lbegin, lend);
-  trace.exit_state("19:final_local_sort");
+  trace.exit_state("12:final_local_sort");
 #else
-  trace.enter_state("18:calc_recv_count (all-to-all)");
-
-  std::vector<size_t> recv_count(nunits, 0);
-
-  DASH_ASSERT_RETURNS(
-  dart_alltoall(
-      // send buffer
-      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-      // receive buffer
-      recv_count.data(),
-      // we send / receive 1 element to / from each process
-      1,
-      // dtype
-      dash::dart_datatype<size_t>::value,
-      // teamid
-      team.dart_id()), DART_OK);
-
-  DASH_LOG_TRACE_RANGE(
-      "recv count", std::begin(recv_count), std::end(recv_count));
-
-  trace.exit_state("18:calc_recv_count (all-to-all)");
-
-  trace.enter_state("19:merge_local_sequences");
+  trace.enter_state("12:merge_local_sequences");
 
   // merging sorted sequences
   auto nsequences = nunits;
   // number of merge steps in the tree
   auto const depth = static_cast<size_t>(std::ceil(std::log2(nsequences)));
 
-  // calculate the prefix sum among all receive counts to find the offsets for
-  // merging
-  std::vector<size_t> recv_count_psum;
-  recv_count_psum.reserve(nsequences + 1);
-  recv_count_psum.emplace_back(0);
-
-  std::partial_sum(
-      std::begin(recv_count),
-      std::end(recv_count),
-      std::back_inserter(recv_count_psum));
-
-  DASH_LOG_TRACE_RANGE(
-      "recv count prefix sum",
-      std::begin(recv_count_psum),
-      std::end(recv_count_psum));
-
   for (std::size_t d = 0; d < depth; ++d) {
     // distance between first and mid iterator while merging
     auto const step = std::size_t(0x1) << d;
@@ -661,14 +545,14 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     nsequences -= nmerges;
   }
 
-  trace.exit_state("19:merge_local_sequences");
+  trace.exit_state("12:merge_local_sequences");
 #endif
 
   DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
 
-  trace.enter_state("20:final_barrier");
+  trace.enter_state("13:final_barrier");
   team.barrier();
-  trace.exit_state("20:final_barrier");
+  trace.exit_state("13:final_barrier");
 }
 
 namespace detail {
@@ -3,10 +3,6 @@
 
 #define IDX_DIST(nunits) ((nunits)*0)
 #define IDX_SUPP(nunits) ((nunits)*1)
-#define IDX_TARGET_DISP(nunits) ((nunits)*2)
-
-#define IDX_SEND_COUNT(nunits) IDX_DIST(nunits)
-#define IDX_TARGET_COUNT(nunits) IDX_SUPP(nunits)
 
 #define NLT_NLE_BLOCK 2
 
@@ -277,10 +273,10 @@ inline bool psort__validate_partitions(
   return nonstable_it == p_borders.is_stable.cend();
 }
 
-template <class LocalArrayT>
 inline void psort__calc_final_partition_dist(
     std::vector<size_t> const& acc_partition_count,
-    LocalArrayT&               l_partition_dist)
+    std::vector<size_t>&       l_partition_data,
+    dash::team_unit_t          myid)
 {
   /* Calculate number of elements to receive for each partition:
    * We first assume that we we receive exactly the number of elements which
@@ -289,10 +285,9 @@ inline void psort__calc_final_partition_dist(
    */
   DASH_LOG_TRACE("< psort__calc_final_partition_dist");
 
-  auto const myid       = l_partition_dist.pattern().team().myid();
-  auto const nunits     = l_partition_dist.pattern().team().size();
-  auto const supp_begin = l_partition_dist.begin() + IDX_SUPP(nunits);
-  auto       dist_begin = l_partition_dist.begin() + IDX_DIST(nunits);
+  auto const nunits     = acc_partition_count.size() - 1;
+  auto const supp_begin = l_partition_data.begin() + IDX_SUPP(nunits);
+  auto       dist_begin = l_partition_data.begin() + IDX_DIST(nunits);
 
   auto const n_my_elements = std::accumulate(
       dist_begin, dist_begin + nunits, static_cast<size_t>(0));
@@ -391,69 +386,6 @@ inline void psort__calc_send_count(
   DASH_LOG_TRACE("psort__calc_send_count >");
 }
 
-template <typename ElementType>
-inline void psort__calc_target_displs(
-    PartitionBorder<ElementType> const& p_borders,
-    std::vector<size_t> const&          valid_partitions,
-    dash::Array<size_t>&                g_partition_data)
-{
-  DASH_LOG_TRACE("< psort__calc_target_displs");
-  auto const nunits = g_partition_data.team().size();
-  auto const myid   = g_partition_data.team().myid();
-
-  auto* l_target_displs = &(g_partition_data.local[IDX_TARGET_DISP(nunits)]);
-
-  if (0 == myid) {
-    // Unit 0 always writes to target offset 0
-    std::fill(l_target_displs, l_target_displs + nunits, 0);
-  }
-
-  std::vector<size_t> target_displs(nunits, 0);
-
-  auto const u_blocksize = g_partition_data.lsize();
-
-  // What this algorithm does is basically an exclusive can over all send
-  // counts across all participating units to find the target displacements of
-  // a unit for all partitions. More precisely, each unit has to know the
-  // starting offset in each partition where the elements should be copied to.
-  //
-  // Note: The one-sided approach here is
-  // probably not the most efficient way. Something like dart_exscan should be
-  // more efficient in large scale scenarios
-
-  for (auto const& border_idx : valid_partitions) {
-    auto const   left_u  = p_borders.left_partition[border_idx];
-    auto const   right_u = border_idx + 1;
-    size_t const val =
-        (left_u == myid)
-            ?
-            /* if we are the bounding unit on the left-hand side we can access
-             * the value in local memory */
-            g_partition_data.local[left_u + IDX_SEND_COUNT(nunits)]
-            :
-            /* Otherwise we have to read the send count remotely from the
-             * corresponding offset at the unit's memory */
-            g_partition_data
-                [left_u * u_blocksize + myid + IDX_SEND_COUNT(nunits)];
-    target_displs[right_u] = val + target_displs[left_u];
-
-    if (right_u == myid) {
-      // we are local
-      g_partition_data.local[IDX_TARGET_DISP(nunits) + myid] =
-          target_displs[right_u];
-    }
-    else {
-      auto const target_offset =
-          right_u * u_blocksize + myid + IDX_TARGET_DISP(nunits);
-
-      g_partition_data.async[target_offset].set(&(target_displs[right_u]));
-    }
-  }
-
-  DASH_LOG_TRACE("psort__calc_target_displs >");
-  g_partition_data.async.flush();
-}
-
 template <typename GlobIterT>
 inline UnitInfo psort__find_partition_borders(
     typename GlobIterT::pattern_type const& pattern,
@@ -198,7 +198,8 @@ public:
 
   /**
    * Set the value of the shared atomic variable.
-   * The operation will block until the local memory can be re-used.
+   * The operation returns immediately and is guaranteed to be completed
+   * after a flush occured.
    */
   void set(const T & value) const
   {
@@ -206,10 +207,9 @@ public:
             "Cannot modify value referenced by GlobAsyncRef<Atomic<const T>>!");
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.set()", value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.set",   _gptr);
-    dart_ret_t ret = dart_accumulate_blocking_local(
+    dart_ret_t ret = dart_accumulate_deferred(
                        _gptr,
                        &value,
-                       1,
                        dash::dart_punned_datatype<nonconst_value_type>::value,
                        DART_OP_REPLACE);
     DASH_ASSERT_EQ(DART_OK, ret, "dart_accumulate failed");
@@ -240,7 +240,8 @@ public:
 
   /**
    * Set the value of the shared atomic variable.
-   * The operation will block until the local memory can be re-used.
+   * The operation returns immediately and is guaranteed to be completed
+   * after a flush occured.
    */
   inline void store(const T & value) const {
     set(value);
@@ -312,6 +313,12 @@ public:
 
   /**
    * Atomically executes specified operation on the referenced shared value.
+   *
+   * The operation returns immediately without waiting for any
+   * communication and is guaranteed to be completed after a flush occured,
+   * e.g., through \ref flush or a barrier on the container. Operations of
+   * the calling unit on the same value are applied in the order in which
+   * they were issued.
    */
   template<typename BinaryOp>
   void op(
@@ -323,14 +330,13 @@ public:
             "Cannot modify value referenced by GlobAsyncRef<Atomic<const T>>!");
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.op()", value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.op",   _gptr);
-    DASH_LOG_TRACE("GlobAsyncRef<Atomic>.op", "dart_accumulate");
-    dart_ret_t ret = dart_accumulate_blocking_local(
+    DASH_LOG_TRACE("GlobAsyncRef<Atomic>.op", "dart_accumulate_deferred");
+    dart_ret_t ret = dart_accumulate_deferred(
                        _gptr,
                        &value,
-                       1,
                        dash::dart_punned_datatype<nonconst_value_type>::value,
                        binary_op.dart_operation());
-    DASH_ASSERT_EQ(DART_OK, ret, "dart_accumulate_blocking_local failed");
+    DASH_ASSERT_EQ(DART_OK, ret, "dart_accumulate_deferred failed");
   }
 
   /**
@@ -3,7 +3,11 @@
 
 #include <dash/Types.h>
 
-#define DART_TAG_SYNC_IMAGES 10016;
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#define DART_TAG_SYNC_IMAGES 10016
 
 /**
  * \defgroup  DashCoarrayLib  Coarray Runtime Interface
@@ -57,75 +61,142 @@ inline void sync_all(){
   dash::barrier();
 }
 
+namespace detail {
+
+/**
+ * Images taking part in a \c sync_images statement in ascending order and
+ * the position of the calling image among them, -1 if it does not take
+ * part.
+ */
+struct SyncImagesSet {
+  std::vector<dart_unit_t> images;
+  int                      pos = -1;
+};
+
+template<typename Container>
+inline SyncImagesSet sync_images_set(const Container & image_ids){
+  SyncImagesSet set;
+  for (const auto & el : image_ids) {
+    set.images.push_back(static_cast<dart_unit_t>(el));
+  }
+  std::sort(set.images.begin(), set.images.end());
+  set.images.erase(std::unique(set.images.begin(), set.images.end()),
+                   set.images.end());
+
+  auto myid = static_cast<dart_unit_t>(this_image());
+  auto it   = std::lower_bound(set.images.begin(), set.images.end(), myid);
+  if (it != set.images.end() && *it == myid) {
+    set.pos = static_cast<int>(std::distance(set.images.begin(), it));
+  }
+  return set;
+}
+
+/**
+ * Image at the given distance from the calling image in the cyclic order
+ * of the participating images.
+ */
+inline global_unit_t sync_images_partner(
+  const SyncImagesSet & set,
+  int                   distance){
+  const int n = static_cast<int>(set.images.size());
+  return global_unit_t{set.images[(((set.pos + distance) % n) + n) % n]};
+}
+
+/**
+ * Handle of the arrival message sent by \c sync_images_begin() that is
+ * completed by the matching \c sync_images_end().
+ */
+inline dart_handle_t & sync_images_send_handle(){
+  static dart_handle_t handle = DART_HANDLE_NULL;
+  return handle;
+}
+
+} // namespace detail
+
+/**
+ * Starts a split-phase \c sync_images statement by announcing the arrival
+ * of the calling image. Computation can be overlapped with the
+ * synchronization until the matching \c sync_images_end() with the same
+ * set of images.
+ *
+ * \sa dash::coarray::sync_images()
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename Container>
+inline void sync_images_begin(const Container & image_ids){
+  auto set = detail::sync_images_set(image_ids);
+  if (set.pos < 0 || set.images.size() < 2) {
+    // I do not participate
+    return;
+  }
+  // The arrival message is sent without blocking, all images send before
+  // receiving. The send buffer must stay valid until sync_images_end():
+  static const char buffer = 0;
+  auto & handle = detail::sync_images_send_handle();
+  DASH_ASSERT_RETURNS(dart_wait(&handle), DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_isend(&buffer, 1, DART_TYPE_BYTE, DART_TAG_SYNC_IMAGES,
+               detail::sync_images_partner(set, 1), &handle),
+    DART_OK);
+}
+
+/**
+ * Completes a split-phase \c sync_images statement started by
+ * \c sync_images_begin(), blocks until all selected units have called
+ * \c sync_images_begin().
+ *
+ * \sa dash::coarray::sync_images()
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename Container>
+inline void sync_images_end(const Container & image_ids){
+  auto set = detail::sync_images_set(image_ids);
+  if (set.pos < 0 || set.images.size() < 2) {
+    // I do not participate
+    return;
+  }
+  auto tag    = DART_TAG_SYNC_IMAGES;
+  char buffer = 0;
+  DASH_ASSERT_RETURNS(
+    dart_recv(&buffer, 1, DART_TYPE_BYTE, tag,
+              detail::sync_images_partner(set, -1)),
+    DART_OK);
+  const int n = static_cast<int>(set.images.size());
+  for (int distance = 2; distance < n; distance *= 2) {
+    DASH_ASSERT_RETURNS(
+      dart_sendrecv(&buffer, 1, DART_TYPE_BYTE, tag,
+                    detail::sync_images_partner(set, distance),
+                    &buffer, 1, DART_TYPE_BYTE, tag,
+                    detail::sync_images_partner(set, -distance)),
+      DART_OK);
+  }
+  DASH_ASSERT_RETURNS(
+    dart_wait(&detail::sync_images_send_handle()), DART_OK);
+}
+
 /**
  * Blocks until all selected units reach this statement. This statement does
  * not imply a flush. If a flush is required, use the \c sync_all() method of
  * the Coarray
  *
  * \note If possible use \c sync_all() or \c Coevent for performance reasons.
- *       \c sync_images() is implemented using two-sided operations based on
- *       a implementation of \c MPI_Barrier(). For dispatching the messages
- *       we use tag DART_TAG_SYNC_IMAGES
+ *       \c sync_images() is implemented using the dissemination algorithm
+ *       on two-sided messages, every selected unit sends and receives
+ *       \f$\lceil \log_2 n \rceil\f$ messages for \f$n\f$ selected units.
+ *       For dispatching the messages we use tag DART_TAG_SYNC_IMAGES
  *
  * \sa dash::coarray::sync_all()
+ * \sa dash::coarray::sync_images_begin()
  *
  * \ingroup DashCoarrayLib
  */
 template<typename Container>
 inline void sync_images(const Container & image_ids){
-  using element = typename Container::value_type;
-
-  auto myid     = this_image();
-
-  if(std::find(image_ids.begin(),
-               image_ids.end(),
-               static_cast<element>(myid)) == image_ids.end())
-  {
-    // I do not participate
-    return;
-  }
-
-  auto root          = global_unit_t{
-                        *(std::min(image_ids.begin(), image_ids.end()))};
-  auto tag           =  DART_TAG_SYNC_IMAGES;
-  // DART does not specify if nullptr is allowed as target
-  char buffer        = 0;
-
-  if(myid == root){
-    // I am root, recv messages from leaves
-    std::for_each(image_ids.begin(), image_ids.end(), [&](const element & el){
-      if(el != root){
-        dart_recv(&buffer, 1, dart_datatype<char>::value,
-                  tag,
-                  global_unit_t{el}
-        );
-      }
-    });
-  } else {
-    // I am a leave, send message to root
-    dart_send(&buffer, 1, DART_TYPE_BYTE,
-              tag,
-              global_unit_t{root});
-  }
-
-  // Second phase: recieve message from root
-  DASH_LOG_DEBUG("Begin second phase of sync_images");
-  if(myid == root){
-    std::for_each(image_ids.begin(), image_ids.end(), [&](const element & el)
-    {
-      if(el != root){
-        dart_send(&buffer, 1, dart_datatype<char>::value,
-                  tag,
-                  global_unit_t{el}
-        );
-      }
-    });
-  } else {
-    dart_recv(&buffer, 1, dart_datatype<char>::value,
-              tag,
-              global_unit_t{root}
-    );
-  }
+  DASH_LOG_DEBUG("sync_images()");
+  sync_images_begin(image_ids);
+  sync_images_end(image_ids);
 }
 
 /**
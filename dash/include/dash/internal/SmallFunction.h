@@ -0,0 +1,231 @@
+#ifndef DASH__INTERNAL__SMALL_FUNCTION_H_
+#define DASH__INTERNAL__SMALL_FUNCTION_H_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dash {
+namespace internal {
+
+template <typename Signature, std::size_t BufferSize = 4 * sizeof(void *)>
+class SmallFunction;
+
+/**
+ * Move-only replacement for \c std::function that stores callables of up
+ * to \c BufferSize bytes in place instead of allocating them on the heap.
+ * Larger callables and callables that may throw when moved are allocated
+ * on the heap.
+ *
+ * A moved-from \c SmallFunction is empty.
+ */
+template <typename R, typename... Args, std::size_t BufferSize>
+class SmallFunction<R(Args...), BufferSize>
+{
+private:
+  typedef SmallFunction<R(Args...), BufferSize> self_t;
+
+  typedef typename std::aligned_storage<
+    BufferSize, alignof(std::max_align_t)>::type storage_t;
+
+  struct ops_t {
+    R    (*invoke)(storage_t & storage, Args... args);
+    void (*move)(storage_t & dst, storage_t & src);
+    void (*destroy)(storage_t & storage);
+  };
+
+  template <typename F>
+  using is_stored_locally = std::integral_constant<bool,
+    sizeof(F)  <= BufferSize &&
+    alignof(F) <= alignof(storage_t) &&
+    std::is_nothrow_move_constructible<F>::value>;
+
+  /// Operations on a callable stored in place.
+  template <typename F>
+  struct local_ops {
+    static F & get(storage_t & storage) {
+      return *reinterpret_cast<F *>(&storage);
+    }
+    static R invoke(storage_t & storage, Args... args) {
+      return get(storage)(std::forward<Args>(args)...);
+    }
+    static void move(storage_t & dst, storage_t & src) {
+      ::new (&dst) F(std::move(get(src)));
+      get(src).~F();
+    }
+    static void destroy(storage_t & storage) {
+      get(storage).~F();
+    }
+    static const ops_t * table() {
+      static const ops_t ops = { &invoke, &move, &destroy };
+      return &ops;
+    }
+  };
+
+  /// Operations on a callable allocated on the heap.
+  template <typename F>
+  struct heap_ops {
+    static F *& get(storage_t & storage) {
+      return *reinterpret_cast<F **>(&storage);
+    }
+    static R invoke(storage_t & storage, Args... args) {
+      return (*get(storage))(std::forward<Args>(args)...);
+    }
+    static void move(storage_t & dst, storage_t & src) {
+      ::new (&dst) F*(get(src));
+    }
+    static void destroy(storage_t & storage) {
+      delete get(storage);
+    }
+    static const ops_t * table() {
+      static const ops_t ops = { &invoke, &move, &destroy };
+      return &ops;
+    }
+  };
+
+  template <typename F>
+  static bool is_empty(const F &) noexcept {
+    return false;
+  }
+
+  template <typename T>
+  static bool is_empty(T * fptr) noexcept {
+    return fptr == nullptr;
+  }
+
+  template <typename Sig>
+  static bool is_empty(const std::function<Sig> & func) noexcept {
+    return !func;
+  }
+
+  template <typename F>
+  void assign(F && f, std::true_type /* stored locally */) {
+    typedef typename std::decay<F>::type fun_t;
+    ::new (&_storage) fun_t(std::forward<F>(f));
+    _ops = local_ops<fun_t>::table();
+  }
+
+  template <typename F>
+  void assign(F && f, std::false_type /* stored locally */) {
+    typedef typename std::decay<F>::type fun_t;
+    ::new (&_storage) fun_t*(new fun_t(std::forward<F>(f)));
+    _ops = heap_ops<fun_t>::table();
+  }
+
+  template <typename F, typename = void>
+  struct is_callable : std::false_type { };
+
+  template <typename F>
+  struct is_callable<F, typename std::enable_if<
+      std::is_void<R>::value ||
+      std::is_convertible<
+        decltype(std::declval<F &>()(std::declval<Args>()...)), R>::value
+    >::type>
+  : std::integral_constant<bool,
+      !std::is_same<typename std::decay<F>::type, self_t>::value> { };
+
+public:
+  /**
+   * Creates an empty function.
+   */
+  SmallFunction() noexcept = default;
+
+  /**
+   * Creates an empty function.
+   */
+  SmallFunction(std::nullptr_t) noexcept { }
+
+  /**
+   * Creates a function wrapping the callable \c f.
+   */
+  template <
+    typename F,
+    typename = typename std::enable_if<
+                 is_callable<typename std::decay<F>::type>::value>::type >
+  SmallFunction(F && f)
+  {
+    if (!is_empty(f)) {
+      assign(std::forward<F>(f),
+             is_stored_locally<typename std::decay<F>::type>());
+    }
+  }
+
+  SmallFunction(self_t && other) noexcept
+  {
+    if (other._ops != nullptr) {
+      other._ops->move(_storage, other._storage);
+      _ops       = other._ops;
+      other._ops = nullptr;
+    }
+  }
+
+  SmallFunction(const self_t & other)      = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  self_t & operator=(self_t && other) noexcept
+  {
+    if (this != &other) {
+      reset();
+      if (other._ops != nullptr) {
+        other._ops->move(_storage, other._storage);
+        _ops       = other._ops;
+        other._ops = nullptr;
+      }
+    }
+    return *this;
+  }
+
+  self_t & operator=(std::nullptr_t) noexcept
+  {
+    reset();
+    return *this;
+  }
+
+  ~SmallFunction()
+  {
+    reset();
+  }
+
+  /**
+   * Invokes the wrapped callable. The function must not be empty.
+   */
+  R operator()(Args... args) const
+  {
+    return _ops->invoke(_storage, std::forward<Args>(args)...);
+  }
+
+  explicit operator bool() const noexcept
+  {
+    return _ops != nullptr;
+  }
+
+  friend bool operator==(const self_t & f, std::nullptr_t) noexcept
+  {
+    return !f;
+  }
+
+  friend bool operator!=(const self_t & f, std::nullptr_t) noexcept
+  {
+    return static_cast<bool>(f);
+  }
+
+private:
+  void reset() noexcept
+  {
+    if (_ops != nullptr) {
+      _ops->destroy(_storage);
+      _ops = nullptr;
+    }
+  }
+
+private:
+  mutable storage_t   _storage;
+  const ops_t       * _ops = nullptr;
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__INTERNAL__SMALL_FUNCTION_H_
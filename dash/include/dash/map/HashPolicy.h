@@ -2,6 +2,17 @@
 #define DASH__MAP__HASH_POLICY_H__INCLUDED
 
 #include <dash/Team.h>
+#include <dash/util/TeamLocality.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace dash {
 template <typename Key>
@@ -43,6 +54,223 @@ class HashLocal {
 
 namespace detail {
 
+/**
+ * Default hash of keys used by the partitioning hash policies.
+ * Uses \c std::hash if it is defined for the key type and hashes the
+ * object representation of the key otherwise.
+ */
+template <typename Key, typename = void>
+struct DefaultKeyHash {
+  std::size_t operator()(const Key& key) const
+  {
+    // FNV-1a
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&key);
+    uint64_t hash = 14695981039346656037ull;
+    for (std::size_t b = 0; b < sizeof(Key); ++b) {
+      hash ^= bytes[b];
+      hash *= 1099511628211ull;
+    }
+    return static_cast<std::size_t>(hash);
+  }
+};
+
+template <typename Key>
+struct DefaultKeyHash<
+  Key,
+  decltype(void(std::hash<Key>()(std::declval<const Key&>())))>
+  : public std::hash<Key> {
+};
+
+/**
+ * Finalizer of MurmurHash3, scrambles all bits of a hash value as
+ * \c std::hash is the identity function for integral keys in common
+ * standard library implementations.
+ */
+inline uint64_t hash_mix(uint64_t hash) noexcept
+{
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * Jump consistent hash by Lamping and Veach, maps a hash value to one of
+ * \c nbuckets buckets such that only 1/n of all hash values are mapped to
+ * a different bucket if the number of buckets grows from n-1 to n.
+ */
+inline int32_t jump_consistent_hash(uint64_t hash, int32_t nbuckets) noexcept
+{
+  int64_t b = -1;
+  int64_t j = 0;
+  while (j < nbuckets) {
+    b = j;
+    hash = hash * 2862933555777941757ull + 1;
+    j = static_cast<int64_t>(
+      (b + 1) * (static_cast<double>(1ll << 31) /
+                 static_cast<double>((hash >> 33) + 1)));
+  }
+  return static_cast<int32_t>(b);
+}
+
+}  // namespace detail
+
+/**
+ * Maps keys to units by their scrambled hash value modulo the number of
+ * units in the team.
+ */
+template <typename Key, typename KeyHash = detail::DefaultKeyHash<Key>>
+class HashModulo {
+ private:
+  typedef dash::default_size_t size_type;
+
+ public:
+  typedef Key argument_type;
+  typedef team_unit_t result_type;
+
+ public:
+  /**
+   * Default constructor.
+   */
+  HashModulo() = default;
+
+  /**
+   * Constructor.
+   */
+  HashModulo(dash::Team& team)
+    : _nunits(team.size())
+  {
+  }
+
+  result_type operator()(const argument_type& key) const
+  {
+    return result_type(static_cast<dart_unit_t>(
+      detail::hash_mix(_key_hash(key)) % _nunits));
+  }
+
+ private:
+  size_type _nunits = 1;
+  KeyHash _key_hash;
+};  // class HashModulo
+
+/**
+ * Maps keys to units by jump consistent hashing. If the map is allocated
+ * in a larger team, only the keys mapped to the additional units change
+ * their unit.
+ */
+template <typename Key, typename KeyHash = detail::DefaultKeyHash<Key>>
+class HashJump {
+ public:
+  typedef Key argument_type;
+  typedef team_unit_t result_type;
+
+ public:
+  /**
+   * Default constructor.
+   */
+  HashJump() = default;
+
+  /**
+   * Constructor.
+   */
+  HashJump(dash::Team& team)
+    : _nunits(static_cast<int32_t>(team.size()))
+  {
+  }
+
+  result_type operator()(const argument_type& key) const
+  {
+    return result_type(
+      detail::jump_consistent_hash(_key_hash(key), _nunits));
+  }
+
+ private:
+  int32_t _nunits = 1;
+  KeyHash _key_hash;
+};  // class HashJump
+
+/**
+ * Maps keys to a node by jump consistent hashing first and then to one of
+ * the units on the node, so keys are distributed evenly across nodes
+ * independent of the number of units per node. The nodes of the team's
+ * units are obtained from \c dash::util::TeamLocality.
+ */
+template <typename Key, typename KeyHash = detail::DefaultKeyHash<Key>>
+class HashNodeFirst {
+ private:
+  typedef std::vector<std::vector<team_unit_t>> node_units_t;
+
+ public:
+  typedef Key argument_type;
+  typedef team_unit_t result_type;
+
+ public:
+  /**
+   * Default constructor.
+   */
+  HashNodeFirst() = default;
+
+  /**
+   * Constructor.
+   */
+  HashNodeFirst(dash::Team& team)
+  {
+    dash::util::TeamLocality tloc(team);
+    auto node_units = std::make_shared<node_units_t>();
+    std::vector<std::string> hosts;
+    for (dart_unit_t u = 0; u < static_cast<dart_unit_t>(team.size()); ++u) {
+      auto host = tloc.unit_locality(team_unit_t(u)).host();
+      auto node = std::find(hosts.begin(), hosts.end(), host);
+      if (node == hosts.end()) {
+        hosts.push_back(host);
+        node_units->emplace_back();
+        node = std::prev(hosts.end());
+      }
+      (*node_units)[node - hosts.begin()].push_back(team_unit_t(u));
+    }
+    _node_units = std::move(node_units);
+  }
+
+  result_type operator()(const argument_type& key) const
+  {
+    if (_node_units == nullptr) {
+      return result_type(0);
+    }
+    uint64_t hash = detail::hash_mix(_key_hash(key));
+    const auto& units = (*_node_units)[detail::jump_consistent_hash(
+      hash, static_cast<int32_t>(_node_units->size()))];
+    // Use other bits of the hash than the node selection:
+    return units[(hash >> 32) % units.size()];
+  }
+
+  /**
+   * Number of nodes the units of the team are located on.
+   */
+  std::size_t num_nodes() const
+  {
+    return _node_units == nullptr ? 0 : _node_units->size();
+  }
+
+ private:
+  /// Units of the team grouped by node, shared by copies of the policy
+  std::shared_ptr<const node_units_t> _node_units;
+  KeyHash _key_hash;
+};  // class HashNodeFirst
+
+namespace detail {
+
+/**
+ * Whether elements are stored at the unit inserting them instead of a
+ * unit determined by their key when using the hash policy \c Hash.
+ */
+template <typename Hash>
+struct is_hash_local : std::false_type { };
+
+template <typename Key>
+struct is_hash_local<dash::HashLocal<Key>> : std::true_type { };
+
 struct HashNodeBase {
   HashNodeBase* _next;
 
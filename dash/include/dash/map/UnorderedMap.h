@@ -19,13 +19,17 @@
 #include <dash/map/UnorderedMapLocalIter.h>
 #include <dash/map/UnorderedMapGlobIter.h>
 #include <dash/map/HashPolicy.h>
+#include <dash/map/UnorderedMapIndex.h>
 
 #include <iterator>
 #include <utility>
 #include <limits>
 #include <vector>
+#include <deque>
+#include <unordered_set>
 #include <functional>
 #include <algorithm>
+#include <numeric>
 #include <cstddef>
 
 
@@ -64,6 +68,13 @@ private:
       dash::global_allocation_policy::epoch_synchronized,
       dash::allocator::DefaultAllocator>;
 
+  typedef dash::detail::UnorderedMapIndex<Key, Pred> key_index_type;
+
+  /// Whether committed elements are stored at the unit their key is mapped
+  /// to by the hash function, so lookups only have to query a single unit.
+  static constexpr bool _placed_by_key =
+    !dash::detail::is_hash_local<Hash>::value;
+
 public:
   typedef Key                                    key_type;
   typedef Mapped                                 mapped_type;
@@ -159,11 +170,22 @@ private:
   local_sizes_map        _local_sizes;
   /// Cumulative (postfix sum) local sizes of all units.
   std::vector<size_type> _local_cumul_sizes;
-  /// Iterators to elements in local memory space that are marked for move
-  /// to remote unit in next commit.
-  std::vector<iterator>  _move_elements;
+  /// Local offsets of elements in local memory space that are marked for
+  /// move to the unit of their key in next commit.
+  std::vector<index_type> _move_elements;
+  /// Elements inserted concurrently that did not fit into the capacity
+  /// reserved at the unit of their key and are moved there in next commit.
+  /// Stored in a deque so references to mapped values obtained from
+  /// \c operator[] remain valid until the commit.
+  std::deque<std::pair<key_type, mapped_type>> _pending_elements;
+  /// Whether elements are inserted into the local memory space of the unit
+  /// of their key directly using one-sided atomic operations.
+  bool                   _concurrent_insert = false;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
+  /// Hash index of the keys of elements in the local memory spaces of all
+  /// units.
+  key_index_type         _key_index;
   /// Hash type for mapping of key to unit and local offset.
   hasher                 _key_hash;
   /// Predicate for key comparison.
@@ -244,38 +266,110 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
+    if (_globmem != nullptr && _concurrent_insert) {
+      // Wait for concurrent insertions of all units to complete, slots in
+      // the local key index may have been claimed by other units:
+      _team->barrier();
+      _key_index.recount();
+    }
+    if (_globmem != nullptr && _placed_by_key) {
+      _move_to_key_units();
+    }
+    if (_globmem != nullptr && _concurrent_insert) {
+      _reserve_concurrent_capacity();
+    }
     // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
       _globmem->commit();
+      _lend = _lbegin + lsize();
     }
-    // Accumulate local sizes of remote units:
-    _local_sizes.barrier();
-    _remote_size = 0;
-    for (int u = 0; u < _team->size(); ++u) {
-      size_type local_size_u;
-      if (u != _myid) {
-        local_size_u = _local_sizes[u];
-        _remote_size += local_size_u;
-      } else {
-        local_size_u = _local_sizes.local[0];
-      }
-      _local_cumul_sizes[u] = local_size_u;
+    // Publish local sizes and index state of all units in a single
+    // collective and accumulate local sizes locally. The key index must
+    // hold all elements that fit into the local capacity if elements are
+    // inserted concurrently:
+    auto nunits = _team->size();
+    std::vector<unsigned long long> lstates(3 * nunits);
+    unsigned long long lstate[3] = {
+      _local_sizes.local[0],
+      _concurrent_insert ? lcapacity() : _local_sizes.local[0],
+      _globmem != nullptr && _key_index.degraded()
+    };
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        lstate, lstates.data(), 3, DART_TYPE_ULONGLONG, _team->dart_id()),
+      DART_OK);
+    size_type max_index_size = 0;
+    bool      index_degraded = false;
+    for (size_t u = 0; u < nunits; ++u) {
+      size_type local_size_u = lstates[3 * u];
+      _local_cumul_sizes[u]  = local_size_u;
       if (u > 0) {
         _local_cumul_sizes[u] += _local_cumul_sizes[u-1];
       }
-      DASH_LOG_TRACE("UnorderedMap.barrier",
-                     "local size at unit", u, ":", local_size_u,
-                     "cumulative size:", _local_cumul_sizes[u]);
+      max_index_size = std::max<size_type>(
+                         max_index_size, lstates[3 * u + 1]);
+      index_degraded = index_degraded || lstates[3 * u + 2];
     }
+    _remote_size = _local_cumul_sizes[nunits-1] - _local_sizes.local[0];
+    DASH_LOG_TRACE("UnorderedMap.barrier",
+                   "local size:", _local_sizes.local[0],
+                   "remote size:", _remote_size);
     auto new_size = size();
     DASH_LOG_TRACE("UnorderedMap.barrier", "new size:", new_size);
-    DASH_ASSERT_EQ(_remote_size, new_size - _local_sizes.local[0],
-                   "invalid size after global commit");
+    if (_globmem != nullptr) {
+      _commit_index(max_index_size, index_degraded);
+    }
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
+  /**
+   * Enable or disable concurrent insertion of elements.
+   *
+   * If enabled, elements are inserted directly at the unit their key is
+   * mapped to by the hash function: a slot in the key index of the unit
+   * is claimed with an atomic compare-and-swap and the element is written
+   * to local capacity reserved at the unit in the last commit with a
+   * one-sided put. Inserted elements are visible to lookups of all units
+   * without a collective commit, but are only included in the global
+   * iteration space and in \c size() after the next \c barrier().
+   * Elements that do not fit into the capacity reserved at their unit
+   * are moved there in the next commit, their insertion returns \c end().
+   *
+   * Requires a hash function that maps keys to units, concurrent
+   * insertion is not supported for \c dash::HashLocal. Elements cannot be
+   * inserted via \c local while concurrent insertion is enabled.
+   *
+   * Collective operation, commits all elements inserted before.
+   */
+  void set_concurrent_insert(bool enable)
+  {
+    DASH_LOG_TRACE("UnorderedMap.set_concurrent_insert()", enable);
+    if (enable && !_placed_by_key) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "UnorderedMap.set_concurrent_insert: concurrent insertion requires "
+        "a hash function that maps keys to units");
+    }
+    // Commit in concurrent mode if it has been enabled before, slots in
+    // the key index may have been claimed by other units:
+    _concurrent_insert = _concurrent_insert || enable;
+    barrier();
+    _concurrent_insert = enable;
+    DASH_LOG_TRACE("UnorderedMap.set_concurrent_insert >");
+  }
+
+  /**
+   * Whether elements are inserted concurrently.
+   *
+   * \see  set_concurrent_insert
+   */
+  bool concurrent_insert() const noexcept
+  {
+    return _concurrent_insert;
+  }
+
   bool allocate(
     /// Initial global capacity of the container.
     size_type    nelem = 0,
@@ -317,6 +411,17 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Index capacity must be equal at all units:
+    unsigned long long index_lcap     = key_index_type::required_capacity(
+                                          lcap);
+    unsigned long long index_lcap_max = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &index_lcap, &index_lcap_max, 1, DART_TYPE_ULONGLONG,
+        DART_OP_MAX, _team->dart_id()),
+      DART_OK);
+    _key_index.allocate(*_team, index_lcap_max);
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -357,6 +462,9 @@ public:
       this, std::bind(&UnorderedMap::deallocate, this));
     // Deallocate map elements:
     DASH_LOG_TRACE_VAR("UnorderedMap.deallocate()", _globmem);
+    if (dash::is_initialized()) {
+      _key_index.deallocate();
+    }
     if (_globmem != nullptr) {
       delete _globmem;
       _globmem = nullptr;
@@ -484,11 +592,17 @@ public:
                                    std::make_pair(key, mapped_type()))
                                 .first;
     DASH_LOG_TRACE_VAR("UnorderedMap.[]", git_value);
-    dart_gptr_t   gptr_mapped = git_value.dart_gptr();
-    auto *        lptr_value  = static_cast<value_type *>(git_value.local());
+    dart_gptr_t   gptr_mapped = DART_GPTR_NULL;
     mapped_type * lptr_mapped = nullptr;
-
-    _lptr_value_to_mapped(lptr_value, gptr_mapped, lptr_mapped);
+    if (git_value == _end) {
+      // Concurrent insertion deferred to the next commit, the reference
+      // writes to the pending element:
+      lptr_mapped = _pending_mapped(key);
+    } else {
+      gptr_mapped = git_value.dart_gptr();
+      auto * lptr_value = static_cast<value_type *>(git_value.local());
+      _lptr_value_to_mapped(lptr_value, gptr_mapped, lptr_mapped);
+    }
     // Create global reference to mapped value member in element:
     mapped_type_reference mapped(gptr_mapped,
                                  lptr_mapped);
@@ -506,7 +620,7 @@ public:
         dash::exception::InvalidArgument,
         "No element in map for key " << key);
     }
-    dart_gptr_t gptr_mapped   = iterator(this, found.pos()).dart_gptr();
+    dart_gptr_t gptr_mapped   = found.dart_gptr();
 
     auto *        lptr_value  = static_cast<value_type *>(found.local());
     mapped_type * lptr_mapped = nullptr;
@@ -553,11 +667,7 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found = _find(key);
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -565,15 +675,38 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    const_iterator found = _find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
 
+  /**
+   * Look up the elements of all keys in the range \c [first, last) and
+   * write an iterator to the element of every key, or \c end() if the key
+   * is not in the map, to \c out.
+   *
+   * Collective operation. Keys are sent to the units storing them in a
+   * single all-to-all exchange and looked up there in a batch. Elements
+   * inserted by other units are only found after they have been
+   * committed in \c barrier().
+   *
+   * \return  Output iterator past the last written iterator.
+   */
+  template<class InputIterator, class OutputIterator>
+  OutputIterator find_bulk(
+    /// Iterator at first key to look up.
+    InputIterator  first,
+    /// Iterator past the last key to look up.
+    InputIterator  last,
+    /// Output iterator receiving a map iterator for every key.
+    OutputIterator out) const
+  {
+    DASH_LOG_TRACE("UnorderedMap.find_bulk()");
+    out = _find_bulk(first, last, out);
+    DASH_LOG_TRACE("UnorderedMap.find_bulk >");
+    return out;
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
@@ -588,6 +721,9 @@ public:
     auto result = std::make_pair(_end, false);
 
     DASH_ASSERT(_globmem != nullptr);
+    if (_concurrent_insert) {
+      return _insert_concurrent(value);
+    }
     // Look up existing element at given key:
     DASH_LOG_TRACE("UnorderedMap.insert", "element key lookup");
     const_iterator found = find(key);
@@ -621,6 +757,9 @@ public:
 
     DASH_ASSERT(_globmem != nullptr);
     DASH_LOG_DEBUG("UnorderedMap.insert()", "key:", key, "mapped:", mapped);
+    if (_concurrent_insert) {
+      return _insert_concurrent(value).first;
+    }
 
     auto unit = _key_hash(key);
 
@@ -628,22 +767,13 @@ public:
 
     if (_myid == unit) {
       DASH_LOG_TRACE("UnorderedMap.insert", "local element key lookup");
-
-      auto lbegin = static_cast<value_type *>(_lbegin);
-      auto lend = static_cast<value_type *>(_lend);
-      const_local_iterator liter = std::find_if(
-                  _lbegin, _lend,
-                   [&](const value_type & v) {
-                     return _key_equal(v.first, key);
-                   });
-
-      if (liter != _lend) {
-        found = iterator(this, _myid, liter.pos());
+      auto lidx = _key_index.find_local(key);
+      if (lidx != key_index_type::npos) {
+        found = iterator(this, _myid, lidx);
       }
-
     } else  {
       DASH_LOG_TRACE("UnorderedMap.insert", "element key lookup");
-      iterator found = find(key);
+      found = find(key);
     }
     DASH_LOG_TRACE_VAR("UnorderedMap.insert", found);
 
@@ -680,6 +810,73 @@ public:
     }
   }
 
+  /**
+   * Insert all values in the range \c [first, last) into the map.
+   * Values with keys that already exist in the map are ignored.
+   *
+   * Collective operation. Values are sent to the unit their key is mapped
+   * to by the hash function in a single all-to-all exchange and appended
+   * to its local elements in a batch. Inserted elements are committed and
+   * visible to all units on return.
+   * With \c dash::HashLocal, values are stored at the unit inserting them
+   * and a new key inserted by several units is stored at the lowest of
+   * these units.
+   */
+  template<class InputIterator>
+  void insert_bulk(
+    /// Iterator at first value in the range to insert.
+    InputIterator first,
+    /// Iterator past the last value in the range to insert.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.insert_bulk()");
+    typedef std::pair<key_type, mapped_type> bulk_value_type;
+    DASH_ASSERT(_globmem != nullptr);
+    std::vector<bulk_value_type> values(first, last);
+    if (!_placed_by_key) {
+      // Elements are stored at the unit that inserted them, filter values
+      // with keys that exist at any unit. Keys inserted by several units
+      // are only stored at the lowest of these units:
+      std::vector<key_type> keys;
+      keys.reserve(values.size());
+      for (const auto & v : values) {
+        keys.push_back(v.first);
+      }
+      std::vector<iterator> found;
+      std::vector<key_type> lower_keys;
+      found.reserve(keys.size());
+      _find_bulk(
+        keys.begin(), keys.end(), std::back_inserter(found), &lower_keys);
+      std::unordered_set<
+        key_type, dash::detail::DefaultKeyHash<key_type>, key_equal>
+        lower_key_set(lower_keys.begin(), lower_keys.end());
+      size_t nvalues = 0;
+      for (size_t i = 0; i < values.size(); ++i) {
+        if (found[i] == _end && lower_key_set.count(values[i].first) == 0) {
+          values[nvalues++] = values[i];
+        }
+      }
+      values.resize(nvalues);
+    }
+    std::vector<bulk_value_type> sendbuf;
+    std::vector<size_t>          send_counts, recv_counts, value_pos;
+    if (_placed_by_key) {
+      _bucket_by_unit(
+        values,
+        [](const bulk_value_type & v) -> const key_type & { return v.first; },
+        sendbuf, send_counts, value_pos);
+    } else {
+      // Elements are stored at the unit inserting them:
+      sendbuf = std::move(values);
+      send_counts.assign(_team->size(), 0);
+      send_counts[_myid] = sendbuf.size();
+    }
+    auto received = _exchange(sendbuf, send_counts, recv_counts);
+    _insert_local_bulk(received);
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.insert_bulk >", "size:", size());
+  }
+
   iterator erase(
     const_iterator position)
   {
@@ -708,6 +905,35 @@ public:
       "dash::UnorderedMap.erase is not implemented.");
   }
 
+  /**
+   * Remove the elements with keys in the range \c [first, last) from the
+   * map.
+   *
+   * Collective operation. Keys are sent to the units storing them in a
+   * single all-to-all exchange and removed there in a batch, moving the
+   * last local elements into the gaps. Invalidates all iterators, changes
+   * are visible to all units on return.
+   */
+  template<class InputIterator>
+  void erase_bulk(
+    /// Iterator at first key to remove.
+    InputIterator first,
+    /// Iterator past the last key to remove.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.erase_bulk()");
+    DASH_ASSERT(_globmem != nullptr);
+    std::vector<key_type> keys(first, last);
+    std::vector<key_type> sendbuf;
+    std::vector<size_t>   send_counts, recv_counts, key_pos;
+    _bucket_by_unit(
+      keys, [](const key_type & k) -> const key_type & { return k; },
+      sendbuf, send_counts, key_pos);
+    _erase_local_bulk(_exchange(sendbuf, send_counts, recv_counts));
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.erase_bulk >", "size:", size());
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Bucket Interface
   //////////////////////////////////////////////////////////////////////////
@@ -823,7 +1049,7 @@ private:
 
     size_type new_local_size   = old_local_size + 1;
     size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
+    _local_cumul_sizes[_myid] += 1;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
@@ -849,29 +1075,28 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
+    _key_index.insert(value.first, old_local_size);
     // Convert local iterator to global iterator:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
+                   "unit:", _myid, "lidx:", old_local_size);
+    result.first  = iterator(this, _myid, old_local_size);
     result.second = true;
 
     if (unit != _myid) {
       DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
-      // Mark inserted element for move to remote unit in next commit:
-      _move_elements.push_back(result.first);
-    } else {
-      ++_lend;
+      // Mark inserted element for move to remote unit in next commit,
+      // invalidates the returned iterator:
+      _move_elements.push_back(old_local_size);
     }
+    ++_lend;
 
-    // Update iterators as global memory space has been changed for the
-    // active unit:
-    auto new_size = size();
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "new size:", new_size);
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _begin");
-    _begin        = iterator(this, 0);
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _end");
-    _end          = iterator(this, new_size);
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _begin);
+    // Global iterators are updated in the next commit. Only the end
+    // position moves by the new local element, the begin position only
+    // changes if the local memory space has been empty:
+    if (old_local_size == 0) {
+      _begin = iterator(this, 0);
+    }
+    _end += 1;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _end);
     DASH_LOG_DEBUG("UnorderedMap._insert_at >",
                    (result.second ? "inserted" : "existing"), ":",
@@ -879,6 +1104,464 @@ private:
     return result;
   }
 
+  /**
+   * Unit the key is mapped to by the hash function.
+   */
+  team_unit_t _key_unit(const key_type & key) const
+  {
+    return const_cast<hasher &>(_key_hash)(key);
+  }
+
+  /**
+   * Number of committed elements in the local memory space of the given
+   * unit.
+   */
+  size_type _committed_lsize(team_unit_t unit) const
+  {
+    return _local_cumul_sizes[unit] -
+           (unit > 0 ? _local_cumul_sizes[unit-1] : 0);
+  }
+
+  /**
+   * Global iterator referencing the element at the given local offset at
+   * the given unit. Elements inserted concurrently since the last commit
+   * are positioned past the end of the global iteration space, so they
+   * are distinct from \c end() and from committed elements.
+   */
+  iterator _iterator_at(team_unit_t unit, index_type lidx) const
+  {
+    auto self = const_cast<self_t *>(this);
+    if (!_concurrent_insert ||
+        static_cast<size_type>(lidx) < _committed_lsize(unit)) {
+      return iterator(self, unit, lidx);
+    }
+    return iterator(
+             self, unit, lidx,
+             _local_cumul_sizes.back() + 1 +
+               unit * _key_index.lcapacity() + lidx);
+  }
+
+  /**
+   * Insert the element at the unit its key is mapped to by the hash
+   * function without a collective commit.
+   */
+  std::pair<iterator, bool> _insert_concurrent(const value_type & value)
+  {
+    DASH_LOG_TRACE("UnorderedMap._insert_concurrent()", "key:", value.first);
+    auto unit = _key_unit(value.first);
+    // Claim a slot for the key in the key index of the unit, fails if
+    // the key is already in the map:
+    index_type lidx;
+    auto slot = _key_index.claim(unit, value.first, lidx);
+    if (slot == key_index_type::npos && lidx != key_index_type::npos) {
+      DASH_LOG_TRACE("UnorderedMap._insert_concurrent >", "existing");
+      return std::make_pair(_iterator_at(unit, lidx), false);
+    }
+    // Reserve a position in the capacity of the unit published in the
+    // last commit:
+    GlobRef<Atomic<size_type>> unit_size(_local_sizes[unit].dart_gptr());
+    if (slot != key_index_type::npos) {
+      lidx = unit_size.fetch_add(1);
+      if (static_cast<size_type>(lidx) >= _globmem->local_size(unit)) {
+        unit_size.sub(1);
+        _key_index.release(unit, slot);
+        slot = key_index_type::npos;
+      }
+    }
+    if (slot == key_index_type::npos) {
+      if (_pending_mapped(value.first) != nullptr) {
+        DASH_LOG_TRACE("UnorderedMap._insert_concurrent >",
+                       "existing, deferred to commit");
+        return std::make_pair(_end, false);
+      }
+      DASH_LOG_TRACE("UnorderedMap._insert_concurrent >",
+                     "no capacity at unit", unit, ", deferred to commit");
+      _pending_elements.emplace_back(value.first, value.second);
+      return std::make_pair(_end, true);
+    }
+    if (unit == _myid) {
+      new (_lptr_at(lidx)) value_type(value);
+    } else {
+      dash::internal::put_blocking(
+        _globmem->at(unit, lidx).dart_gptr(), &value, 1);
+    }
+    _key_index.publish(unit, slot, value.first, lidx);
+    DASH_LOG_TRACE("UnorderedMap._insert_concurrent >",
+                   "unit:", unit, "lidx:", lidx);
+    return std::make_pair(_iterator_at(unit, lidx), true);
+  }
+
+  /**
+   * Native pointer to the mapped value of the element with the given key
+   * that has been deferred to the next commit in concurrent insertion, or
+   * \c nullptr if no such element has been inserted by the local unit.
+   */
+  mapped_type * _pending_mapped(const key_type & key)
+  {
+    for (auto & pending : _pending_elements) {
+      if (_key_equal(pending.first, key)) {
+        return &(pending.second);
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * Grow local memory so that elements can be inserted concurrently by
+   * other units until the next commit.
+   */
+  void _reserve_concurrent_capacity()
+  {
+    size_type lsize   = _local_sizes.local[0];
+    size_type reserve = std::max<size_type>(_local_buffer_size, lsize);
+    size_type lcap    = _globmem->local_size();
+    if (lcap - lsize < reserve / 2) {
+      _globmem->grow(reserve);
+    }
+  }
+
+  /**
+   * Look up the element with the given key in the key index of the local
+   * unit and, if not found, in the index of the unit the key is mapped to
+   * by the hash function. If elements are stored at the unit that
+   * inserted them, the key is looked up in the indices of all units.
+   */
+  iterator _find(const key_type & key) const
+  {
+    auto self = const_cast<self_t *>(this);
+    // Local elements, including elements that have not been committed:
+    auto lidx = _key_index.find_local(key);
+    if (lidx != key_index_type::npos) {
+      return _iterator_at(_myid, lidx);
+    }
+    // Elements inserted concurrently are published in the index of their
+    // unit after they have been written:
+    auto lookup_at = [&](team_unit_t unit) {
+      auto lidx = _key_index.find(unit, key);
+      return (lidx != key_index_type::npos &&
+              (_concurrent_insert ||
+               static_cast<size_type>(lidx) < _committed_lsize(unit)))
+             ? _iterator_at(unit, lidx)
+             : _end;
+    };
+    if (_placed_by_key) {
+      auto unit = _key_unit(key);
+      return unit == _myid ? _end : lookup_at(unit);
+    }
+    for (team_unit_t unit{0}; unit < _team->size(); ++unit) {
+      if (unit != _myid) {
+        auto found = lookup_at(unit);
+        if (found != _end) {
+          return found;
+        }
+      }
+    }
+    return _end;
+  }
+
+  /**
+   * Grow the key index to the capacity required for \c max_index_size
+   * elements at every unit, or rebuild it if the index of any unit is
+   * degraded.
+   * Collective operation on the map's team, arguments must be equal at
+   * all units.
+   */
+  void _commit_index(size_type max_index_size, bool degraded)
+  {
+    auto lcap = key_index_type::required_capacity(max_index_size);
+    if (lcap > _key_index.lcapacity() || degraded) {
+      _key_index.rebuild(
+        *_team,
+        std::max<size_type>(lcap, _key_index.lcapacity()),
+        _local_sizes.local[0],
+        [&](index_type lidx) -> const key_type & {
+          return _lptr_at(lidx)->first;
+        });
+    }
+  }
+
+  /**
+   * Move elements inserted at units other than the unit of their key and
+   * elements deferred in concurrent insertion to the unit of their key.
+   * Collective operation on the map's team.
+   */
+  void _move_to_key_units()
+  {
+    unsigned long long nmove     = _move_elements.size() +
+                                   _pending_elements.size();
+    unsigned long long nmove_max = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &nmove, &nmove_max, 1, DART_TYPE_ULONGLONG, DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    if (nmove_max == 0) {
+      return;
+    }
+    typedef std::pair<key_type, mapped_type> move_value_type;
+    std::vector<move_value_type> values;
+    std::vector<key_type>        keys;
+    values.reserve(nmove);
+    keys.reserve(_move_elements.size());
+    for (auto lidx : _move_elements) {
+      values.push_back(*_lptr_at(lidx));
+      keys.push_back(values.back().first);
+    }
+    _move_elements.clear();
+    _erase_local_bulk(keys);
+    values.insert(
+      values.end(), _pending_elements.begin(), _pending_elements.end());
+    _pending_elements.clear();
+    std::vector<move_value_type> sendbuf;
+    std::vector<size_t>          send_counts, recv_counts, value_pos;
+    _bucket_by_unit(
+      values,
+      [](const move_value_type & v) -> const key_type & { return v.first; },
+      sendbuf, send_counts, value_pos);
+    _insert_local_bulk(_exchange(sendbuf, send_counts, recv_counts));
+  }
+
+  /**
+   * Native pointer to the element at the given offset in local memory.
+   */
+  value_type * _lptr_at(index_type lidx) const
+  {
+    return static_cast<value_type *>(_globmem->lbegin() + lidx);
+  }
+
+  /**
+   * Destination units of the keys in a bulk operation: the unit the key
+   * is mapped to by the hash function or, if elements are stored at the
+   * unit that inserted them, all units.
+   * Fills the send buffer with the values grouped by destination unit and
+   * \c value_pos with the position of every sent value in \c values.
+   */
+  template <typename ValueT, typename KeyOfFun>
+  void _bucket_by_unit(
+    const std::vector<ValueT> & values,
+    KeyOfFun                    key_of,
+    std::vector<ValueT>       & sendbuf,
+    std::vector<size_t>       & send_counts,
+    std::vector<size_t>       & value_pos) const
+  {
+    auto nunits = _team->size();
+    send_counts.assign(nunits, 0);
+    if (!_placed_by_key) {
+      sendbuf.clear();
+      value_pos.clear();
+      sendbuf.reserve(nunits * values.size());
+      value_pos.reserve(nunits * values.size());
+      for (size_t u = 0; u < nunits; ++u) {
+        sendbuf.insert(sendbuf.end(), values.begin(), values.end());
+        for (size_t i = 0; i < values.size(); ++i) {
+          value_pos.push_back(i);
+        }
+        send_counts[u] = values.size();
+      }
+      return;
+    }
+    std::vector<team_unit_t> value_units;
+    value_units.reserve(values.size());
+    for (const auto & v : values) {
+      value_units.push_back(_key_unit(key_of(v)));
+      ++send_counts[value_units.back()];
+    }
+    std::vector<size_t> offsets(nunits, 0);
+    std::partial_sum(
+      send_counts.begin(), std::prev(send_counts.end()),
+      std::next(offsets.begin()));
+    sendbuf.resize(values.size());
+    value_pos.resize(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      auto pos       = offsets[value_units[i]]++;
+      sendbuf[pos]   = values[i];
+      value_pos[pos] = i;
+    }
+  }
+
+  /**
+   * Send the values in \c sendbuf, grouped by destination unit, to the
+   * units of the team in a single all-to-all exchange.
+   * Collective operation on the map's team.
+   *
+   * \return  The received values, grouped by source unit.
+   */
+  template <typename ValueT>
+  std::vector<ValueT> _exchange(
+    const std::vector<ValueT> & sendbuf,
+    const std::vector<size_t> & send_counts,
+    std::vector<size_t>       & recv_counts) const
+  {
+    auto nunits = _team->size();
+    recv_counts.assign(nunits, 0);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        send_counts.data(), recv_counts.data(), 1,
+        dash::dart_datatype<size_t>::value, _team->dart_id()),
+      DART_OK);
+    std::vector<ValueT> recvbuf(
+      std::accumulate(recv_counts.begin(), recv_counts.end(), size_t(0)));
+    // Counts and displacements in units of the DART storage type of the
+    // values, which are bytes for non-arithmetic value types
+    std::vector<size_t> nsend(nunits), sdispls(nunits, 0);
+    std::vector<size_t> nrecv(nunits), rdispls(nunits, 0);
+    for (size_t u = 0; u < nunits; ++u) {
+      nsend[u] = dash::dart_storage<ValueT>(send_counts[u]).nelem;
+      nrecv[u] = dash::dart_storage<ValueT>(recv_counts[u]).nelem;
+      if (u > 0) {
+        sdispls[u] = sdispls[u-1] + nsend[u-1];
+        rdispls[u] = rdispls[u-1] + nrecv[u-1];
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+        sendbuf.data(), nsend.data(), sdispls.data(),
+        dash::dart_storage<ValueT>::dtype,
+        recvbuf.data(), nrecv.data(), rdispls.data(),
+        _team->dart_id()),
+      DART_OK);
+    return recvbuf;
+  }
+
+  /**
+   * Look up the keys in the range \c [first, last) at the units they may
+   * be stored at and write an iterator to the element of every key, or
+   * \c end() if the key is not in the map, to \c out.
+   * If \c lower_keys is specified, it receives the keys queried at this
+   * unit by units with a lower id.
+   * Collective operation on the map's team.
+   */
+  template <class InputIterator, class OutputIterator>
+  OutputIterator _find_bulk(
+    InputIterator           first,
+    InputIterator           last,
+    OutputIterator          out,
+    std::vector<key_type> * lower_keys = nullptr) const
+  {
+    auto self = const_cast<self_t *>(this);
+    std::vector<key_type> keys(first, last);
+    std::vector<key_type> sendbuf;
+    std::vector<size_t>   send_counts, recv_counts, key_pos;
+    _bucket_by_unit(
+      keys, [](const key_type & k) -> const key_type & { return k; },
+      sendbuf, send_counts, key_pos);
+    auto queries = _exchange(sendbuf, send_counts, recv_counts);
+    if (lower_keys != nullptr) {
+      lower_keys->assign(
+        queries.begin(),
+        queries.begin() + std::accumulate(
+                            recv_counts.begin(),
+                            recv_counts.begin() + _myid, size_t(0)));
+    }
+    // Answer queries of all units from the local key index:
+    std::vector<index_type> answers;
+    answers.reserve(queries.size());
+    for (const auto & key : queries) {
+      answers.push_back(_key_index.find_local(key));
+    }
+    std::vector<size_t> answer_counts;
+    auto results = _exchange(answers, recv_counts, answer_counts);
+    std::vector<iterator> found(keys.size(), _end);
+    size_t r = 0;
+    for (team_unit_t unit{0}; unit < _team->size(); ++unit) {
+      for (size_t i = 0; i < send_counts[unit]; ++i, ++r) {
+        auto lidx = results[r];
+        if (lidx != key_index_type::npos &&
+            (unit == _myid ||
+             static_cast<size_type>(lidx) < _committed_lsize(unit)) &&
+            found[key_pos[r]] == _end) {
+          found[key_pos[r]] = iterator(self, unit, lidx);
+        }
+      }
+    }
+    return std::copy(found.begin(), found.end(), out);
+  }
+
+  /**
+   * Append the values with keys not contained in local memory to the
+   * local elements in a single allocation.
+   */
+  template <typename ValueT>
+  void _insert_local_bulk(const std::vector<ValueT> & values)
+  {
+    if (_concurrent_insert) {
+      // Slots in the local key index may have been claimed by other units:
+      _key_index.recount();
+    }
+    size_type old_local_size = _local_sizes.local[0];
+    std::vector<const ValueT *> inserted;
+    for (const auto & v : values) {
+      if (_key_index.find_local(v.first) == key_index_type::npos) {
+        _key_index.insert(v.first, old_local_size + inserted.size());
+        inserted.push_back(&v);
+      }
+    }
+    size_type ninsert = inserted.size();
+    if (ninsert == 0) {
+      return;
+    }
+    GlobRef<Atomic<size_type>>(_local_size_gptr).add(ninsert);
+    // Fill remaining local capacity first, then grow local memory once.
+    // Remaining capacity may span several buckets of local memory, grown
+    // memory is contiguous:
+    size_type local_capacity = _globmem->local_size();
+    size_type nfit           = std::min<size_type>(
+                                 ninsert, local_capacity - old_local_size);
+    for (size_type i = 0; i < nfit; ++i) {
+      new (_lptr_at(old_local_size + i)) value_type(*inserted[i]);
+    }
+    if (nfit < ninsert) {
+      value_type * lptr_insert = static_cast<value_type *>(
+                                   _globmem->grow(
+                                     std::max(ninsert - nfit,
+                                              _local_buffer_size)));
+      for (size_type i = nfit; i < ninsert; ++i) {
+        new (lptr_insert++) value_type(*inserted[i]);
+      }
+    }
+    _local_cumul_sizes[_myid] += ninsert;
+    _lend = _lbegin + lsize();
+  }
+
+  /**
+   * Remove the elements with the given keys from local memory, moving the
+   * last local elements into the gaps.
+   */
+  void _erase_local_bulk(const std::vector<key_type> & keys)
+  {
+    size_type local_size = _local_sizes.local[0];
+    size_type nerased    = 0;
+    for (const auto & key : keys) {
+      auto lidx = _key_index.find_local(key);
+      if (lidx == key_index_type::npos) {
+        continue;
+      }
+      _key_index.erase(key);
+      size_type last_lidx = local_size - nerased - 1;
+      value_type * lptr   = _lptr_at(lidx);
+      lptr->~value_type();
+      _move_elements.erase(
+        std::remove(_move_elements.begin(), _move_elements.end(), lidx),
+        _move_elements.end());
+      if (static_cast<size_type>(lidx) != last_lidx) {
+        value_type * lptr_last = _lptr_at(last_lidx);
+        new (lptr) value_type(*lptr_last);
+        lptr_last->~value_type();
+        _key_index.relocate(lptr->first, lidx);
+        std::replace(
+          _move_elements.begin(), _move_elements.end(),
+          static_cast<index_type>(last_lidx), lidx);
+      }
+      ++nerased;
+    }
+    if (nerased == 0) {
+      return;
+    }
+    GlobRef<Atomic<size_type>>(_local_size_gptr).sub(nerased);
+    _local_cumul_sizes[_myid] -= nerased;
+    _lend = _lbegin + lsize();
+  }
+
 }; // class UnorderedMap
 
 #endif // ifndef DOXYGEN
@@ -144,6 +144,27 @@ public:
     DASH_LOG_TRACE("UnorderedMapGlobIter(map,unit,lidx) >");
   }
 
+  /**
+   * Constructor, creates iterator at local position relative to the
+   * specified unit's local iteration space with an explicit position in
+   * global canonical index space, for elements that have not been
+   * committed to the global iteration space yet.
+   */
+  UnorderedMapGlobIter(
+    map_t         * map,
+    team_unit_t     unit,
+    index_type      local_index,
+    index_type      position)
+  : _map(map),
+    _idx(position),
+    _myid(map->team().myid()),
+    _idx_unit_id(unit),
+    _idx_local_idx(local_index)
+  {
+    DASH_LOG_TRACE("UnorderedMapGlobIter(map,unit,lidx,pos)",
+                   "unit:", unit, "lidx:", local_index, "gidx:", _idx);
+  }
+
   /**
    * Copy constructor.
    */
@@ -0,0 +1,560 @@
+#ifndef DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
+#define DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+
+#include <dash/map/HashPolicy.h>
+
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+
+namespace dash {
+namespace detail {
+
+/**
+ * Entry in the index of a unit's local partition of an unordered map.
+ */
+template <typename Key>
+struct UnorderedMapIndexSlot
+{
+  /// One of \c UnorderedMapIndex::EMPTY, \c FULL, \c ERASED or \c BUSY
+  int32_t               state;
+  /// Local offset of the element in the memory space of the unit
+  dash::default_index_t lidx;
+  /// Key of the element
+  Key                   key;
+};
+
+/**
+ * Distributed open-addressing hash index over the elements of an
+ * unordered map.
+ *
+ * Every unit indexes the keys of the elements in its local memory space
+ * in a table of \c lcapacity() slots in global memory. All units use the
+ * same capacity, so the slots of a key are at the same offset at every
+ * unit and any unit can look up a key at a remote unit by reading a
+ * single bucket of slots of the remote table.
+ *
+ * Keys are placed by linear probing starting at the first slot of their
+ * bucket. Slots of erased keys are marked as erased instead of being
+ * freed, so a lookup terminates at the first empty slot and only reads the
+ * following bucket if all slots in the bucket are occupied by other keys.
+ *
+ * Local insertions are visible to local lookups immediately. If the load
+ * of the table exceeds 3/4, keys are stored in a local overflow table
+ * until the index is rebuilt collectively in \c rebuild.
+ *
+ * Alternatively, slots at any unit can be claimed with an atomic
+ * compare-and-swap on their state in \c claim and filled in \c publish,
+ * so units can insert keys into the index of another unit concurrently.
+ * The two modes of insertion must not be mixed between two collective
+ * operations on the index.
+ */
+template <typename Key, typename Pred = std::equal_to<Key>>
+class UnorderedMapIndex
+{
+private:
+  typedef UnorderedMapIndex<Key, Pred> self_t;
+
+public:
+  typedef dash::default_index_t          index_type;
+  typedef dash::default_size_t           size_type;
+  typedef UnorderedMapIndexSlot<Key>     slot_type;
+
+  enum : int32_t {
+    EMPTY  = 0,
+    FULL   = 1,
+    ERASED = 2,
+    BUSY   = 3
+  };
+
+  /// Returned by lookups of keys that are not in the index.
+  static constexpr index_type npos = -1;
+
+  /// Number of slots read from a remote unit in a single lookup.
+  static constexpr size_type bucket_size = 8;
+
+public:
+  UnorderedMapIndex()                          = default;
+  UnorderedMapIndex(const self_t & other)      = delete;
+  self_t & operator=(const self_t & other)     = delete;
+
+  /**
+   * Local capacity of the index required for \c nelem elements.
+   */
+  static size_type required_capacity(size_type nelem) noexcept
+  {
+    size_type lcap = bucket_size;
+    while (lcap < 2 * nelem) {
+      lcap *= 2;
+    }
+    return lcap;
+  }
+
+  /**
+   * Allocate an empty index with \c lcap slots at every unit.
+   * Collective operation on \c team.
+   */
+  void allocate(dash::Team & team, size_type lcap)
+  {
+    DASH_LOG_TRACE("UnorderedMapIndex.allocate()", "lcap:", lcap);
+    DASH_ASSERT_MSG(lcap >= bucket_size && (lcap & (lcap - 1)) == 0,
+                    "index capacity must be a power of two");
+    _team = &team;
+    _myid = team.myid();
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(
+        team.dart_id(), lcap * sizeof(slot_type), DART_TYPE_BYTE, &_gptr),
+      DART_OK);
+    dart_gptr_t lgptr = _gptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_setunit(&lgptr, _myid),
+      DART_OK);
+    void * addr = nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(lgptr, &addr),
+      DART_OK);
+    _lslots = static_cast<slot_type *>(addr);
+    std::memset(_lslots, 0, lcap * sizeof(slot_type));
+    _lcap   = lcap;
+    _nbits  = 0;
+    while ((size_type(1) << _nbits) < lcap / bucket_size) {
+      ++_nbits;
+    }
+    _count  = 0;
+    _nerased = 0;
+    _overflow.clear();
+    // Slots must be initialized at all units before they are read:
+    _team->barrier();
+    DASH_LOG_TRACE("UnorderedMapIndex.allocate >");
+  }
+
+  /**
+   * Free the index. Collective operation on the team of the index.
+   */
+  void deallocate()
+  {
+    if (DART_GPTR_ISNULL(_gptr)) {
+      return;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_team_memfree(_gptr),
+      DART_OK);
+    _gptr   = DART_GPTR_NULL;
+    _lslots = nullptr;
+    _lcap   = 0;
+    _count  = 0;
+    _nerased = 0;
+    _overflow.clear();
+  }
+
+  /**
+   * Whether local elements are missing in the table or erased slots
+   * lengthen lookups, so the index should be rebuilt.
+   */
+  bool degraded() const noexcept
+  {
+    return !_overflow.empty() || 4 * _nerased > _lcap;
+  }
+
+  /**
+   * Index the \c nelem local elements again in a table with \c lcap slots
+   * per unit, with the key of the element at local offset \c i obtained
+   * from <tt>key_at(i)</tt>. The table is only reallocated if its capacity
+   * changes.
+   * Collective operation on \c team, \c lcap must be equal at all units.
+   */
+  template <typename KeyAtFun>
+  void rebuild(
+    dash::Team & team,
+    size_type    lcap,
+    size_type    nelem,
+    KeyAtFun     key_at)
+  {
+    DASH_LOG_TRACE("UnorderedMapIndex.rebuild()",
+                   "lcap:", _lcap, "->", lcap, "nelem:", nelem);
+    if (lcap != _lcap) {
+      deallocate();
+      allocate(team, lcap);
+    } else {
+      std::memset(_lslots, 0, _lcap * sizeof(slot_type));
+      _count   = 0;
+      _nerased = 0;
+      _overflow.clear();
+    }
+    for (size_type lidx = 0; lidx < nelem; ++lidx) {
+      insert(key_at(lidx), lidx);
+    }
+    // Slots must be filled at all units before they are read:
+    _team->barrier();
+    DASH_LOG_TRACE("UnorderedMapIndex.rebuild >");
+  }
+
+  /**
+   * Count the occupied and erased local slots again after slots have been
+   * claimed by other units.
+   */
+  void recount() noexcept
+  {
+    _count   = 0;
+    _nerased = 0;
+    for (size_type slot = 0; slot < _lcap; ++slot) {
+      if (_lslots[slot].state != EMPTY) {
+        ++_count;
+      }
+      if (_lslots[slot].state == ERASED) {
+        ++_nerased;
+      }
+    }
+  }
+
+  /**
+   * Local capacity of the index.
+   */
+  size_type lcapacity() const noexcept
+  {
+    return _lcap;
+  }
+
+  /**
+   * Add the element with key \c key at local offset \c lidx to the index
+   * of the calling unit.
+   */
+  void insert(const Key & key, index_type lidx)
+  {
+    if (4 * (_count + 1) > 3 * _lcap) {
+      _overflow.emplace(key, lidx);
+      return;
+    }
+    size_type slot = first_slot(key);
+    while (_lslots[slot].state != EMPTY) {
+      slot = (slot + 1) & (_lcap - 1);
+    }
+    _lslots[slot].lidx  = lidx;
+    ::new (&_lslots[slot].key) Key(key);
+    // Remote units must not see the slot occupied before key and offset
+    // have been written:
+    std::atomic_thread_fence(std::memory_order_release);
+    _lslots[slot].state = FULL;
+    ++_count;
+  }
+
+  /**
+   * Local offset of the element with key \c key at the calling unit, or
+   * \c npos if there is no such element.
+   */
+  index_type find_local(const Key & key) const
+  {
+    const slot_type * s = const_cast<self_t *>(this)->find_slot(key);
+    if (s != nullptr) {
+      return s->lidx;
+    }
+    if (!_overflow.empty()) {
+      auto it = _overflow.find(key);
+      if (it != _overflow.end()) {
+        return it->second;
+      }
+    }
+    return npos;
+  }
+
+  /**
+   * Remove the element with key \c key from the index of the calling unit.
+   *
+   * \return  \c true if the key has been found, \c false otherwise.
+   */
+  bool erase(const Key & key)
+  {
+    slot_type * s = find_slot(key);
+    if (s != nullptr) {
+      s->state = ERASED;
+      ++_nerased;
+      return true;
+    }
+    return _overflow.erase(key) > 0;
+  }
+
+  /**
+   * Change the local offset of the element with key \c key in the index of
+   * the calling unit to \c lidx.
+   */
+  void relocate(const Key & key, index_type lidx)
+  {
+    slot_type * s = find_slot(key);
+    if (s != nullptr) {
+      s->lidx = lidx;
+      return;
+    }
+    auto it = _overflow.find(key);
+    DASH_ASSERT_MSG(it != _overflow.end(), "relocated key is not indexed");
+    it->second = lidx;
+  }
+
+  /**
+   * Local offset of the element with key \c key at unit \c unit, or
+   * \c npos if there is no such element in the index of the unit.
+   * Reads a single bucket of slots from remote units unless the bucket
+   * is full.
+   */
+  index_type find(team_unit_t unit, const Key & key) const
+  {
+    if (unit == _myid) {
+      return find_local(key);
+    }
+    if (DART_GPTR_ISNULL(_gptr)) {
+      return npos;
+    }
+    slot_type bucket[bucket_size];
+    size_type slot = first_slot(key);
+    for (size_type probe = 0; probe < _lcap; probe += bucket_size) {
+      dash::internal::get_blocking(slot_gptr(unit, slot), bucket, bucket_size);
+      for (size_type s = 0; s < bucket_size; ++s) {
+        if (bucket[s].state == EMPTY) {
+          return npos;
+        }
+        if (bucket[s].state == FULL && _key_equal(bucket[s].key, key)) {
+          return bucket[s].lidx;
+        }
+      }
+      slot = (slot + bucket_size) & (_lcap - 1);
+    }
+    return npos;
+  }
+
+  /**
+   * Claim an empty slot for the key \c key in the index of unit \c unit
+   * with an atomic compare-and-swap on the state of the slot. Slots
+   * claimed by other units are waited for until they have been published
+   * or released, so the same key cannot be claimed twice.
+   *
+   * \return  The claimed slot, or \c npos if the key is already in the
+   *          index of the unit or no empty slot has been found. In the
+   *          first case, \c lidx is set to the local offset of the
+   *          existing element, otherwise to \c npos.
+   */
+  index_type claim(team_unit_t unit, const Key & key, index_type & lidx)
+  {
+    lidx = npos;
+    if (DART_GPTR_ISNULL(_gptr)) {
+      return npos;
+    }
+    slot_type bucket[bucket_size];
+    size_type slot = first_slot(key);
+    for (size_type probe = 0; probe < _lcap; probe += bucket_size) {
+      dash::internal::get_blocking(slot_gptr(unit, slot), bucket, bucket_size);
+      for (size_type s = 0; s < bucket_size; ++s) {
+        slot_type & entry = bucket[s];
+        bool        retry = false;
+        while (entry.state == EMPTY || entry.state == BUSY) {
+          if (entry.state == EMPTY) {
+            entry.state = compare_and_swap_state(unit, slot + s, EMPTY, BUSY);
+            if (entry.state == EMPTY) {
+              return slot + s;
+            }
+          } else {
+            // Wait for the claiming unit to publish or release the slot.
+            // The state is read atomically as reads from shared memory
+            // windows do not progress the operations of the claiming
+            // unit targeting this unit:
+            entry.state = fetch_state(unit, slot + s);
+          }
+          retry = true;
+        }
+        if (retry) {
+          dash::internal::get_blocking(slot_gptr(unit, slot + s), &entry, 1);
+        }
+        if (entry.state == FULL && _key_equal(entry.key, key)) {
+          lidx = entry.lidx;
+          return npos;
+        }
+      }
+      slot = (slot + bucket_size) & (_lcap - 1);
+    }
+    return npos;
+  }
+
+  /**
+   * Store key and local offset of an element in the slot at unit \c unit
+   * previously claimed in \c claim and make it visible to lookups.
+   */
+  void publish(
+    team_unit_t  unit,
+    index_type   slot,
+    const Key  & key,
+    index_type   lidx)
+  {
+    slot_type entry;
+    entry.lidx = lidx;
+    ::new (&entry.key) Key(key);
+    // Write offset and key but not the state of the slot, which is only
+    // modified atomically:
+    auto offset = reinterpret_cast<const char *>(&entry.lidx) -
+                  reinterpret_cast<const char *>(&entry);
+    dart_gptr_t gptr = slot_gptr(unit, slot);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, offset),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_put_blocking(
+        gptr, reinterpret_cast<const char *>(&entry) + offset,
+        sizeof(slot_type) - offset, DART_TYPE_BYTE, DART_TYPE_BYTE),
+      DART_OK);
+    set_state(unit, slot, FULL);
+  }
+
+  /**
+   * Release a slot at unit \c unit previously claimed in \c claim without
+   * storing a key. The slot is marked as erased as lookups of keys
+   * inserted concurrently may have probed past it.
+   */
+  void release(team_unit_t unit, index_type slot)
+  {
+    set_state(unit, slot, ERASED);
+  }
+
+private:
+  /**
+   * Global pointer to a slot in the index of the given unit.
+   */
+  dart_gptr_t slot_gptr(team_unit_t unit, size_type slot) const
+  {
+    dart_gptr_t gptr = _gptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_setunit(&gptr, unit),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, slot * sizeof(slot_type)),
+      DART_OK);
+    return gptr;
+  }
+
+  /**
+   * Atomically replace the state of a slot if it equals \c expected.
+   *
+   * \return  The state of the slot before the operation.
+   */
+  int32_t compare_and_swap_state(
+    team_unit_t unit,
+    size_type   slot,
+    int32_t     expected,
+    int32_t     desired)
+  {
+    dart_gptr_t gptr   = slot_gptr(unit, slot);
+    int32_t     result = 0;
+    DASH_ASSERT_RETURNS(
+      dart_compare_and_swap(
+        gptr, &desired, &expected, &result,
+        dash::dart_datatype<int32_t>::value),
+      DART_OK);
+    dart_flush(gptr);
+    return result;
+  }
+
+  int32_t fetch_state(team_unit_t unit, size_type slot)
+  {
+    dart_gptr_t gptr   = slot_gptr(unit, slot);
+    int32_t     value  = 0;
+    int32_t     result = 0;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        gptr, &value, &result, dash::dart_datatype<int32_t>::value,
+        DART_OP_NO_OP),
+      DART_OK);
+    dart_flush(gptr);
+    return result;
+  }
+
+  void set_state(team_unit_t unit, size_type slot, int32_t state)
+  {
+    dart_gptr_t gptr = slot_gptr(unit, slot);
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        gptr, &state, 1, dash::dart_datatype<int32_t>::value,
+        DART_OP_REPLACE),
+      DART_OK);
+    dart_flush(gptr);
+  }
+
+  /**
+   * Local slot of the key, or \c nullptr if the key is not in the table.
+   */
+  slot_type * find_slot(const Key & key)
+  {
+    if (_lslots == nullptr) {
+      return nullptr;
+    }
+    size_type slot = first_slot(key);
+    for (size_type probe = 0; probe < _lcap; ++probe) {
+      slot_type & s = _lslots[slot];
+      if (s.state == EMPTY) {
+        break;
+      }
+      if (s.state == FULL && _key_equal(s.key, key)) {
+        return &s;
+      }
+      slot = (slot + 1) & (_lcap - 1);
+    }
+    return nullptr;
+  }
+
+  /**
+   * First slot of the bucket of the key, using the high bits of the
+   * multiplicatively scrambled hash value as keys of a unit often share
+   * their low bits.
+   */
+  size_type first_slot(const Key & key) const
+  {
+    uint64_t hash = static_cast<uint64_t>(_key_hash(key))
+                    * 0x9e3779b97f4a7c15ull;
+    size_type bucket = _nbits == 0
+                       ? 0
+                       : static_cast<size_type>(hash >> (64 - _nbits));
+    return bucket * bucket_size;
+  }
+
+private:
+  dash::Team                            * _team   = nullptr;
+  team_unit_t                             _myid{DART_UNDEFINED_UNIT_ID};
+  /// Global pointer to the index table
+  dart_gptr_t                             _gptr   = DART_GPTR_NULL;
+  /// Native pointer to the index table of the calling unit
+  slot_type                             * _lslots = nullptr;
+  /// Number of slots per unit
+  size_type                               _lcap   = 0;
+  /// Number of bits of the bucket index
+  int                                     _nbits  = 0;
+  /// Number of occupied or erased local slots
+  size_type                               _count  = 0;
+  /// Number of erased local slots
+  size_type                               _nerased = 0;
+  /// Local elements that have not been placed in a slot
+  std::unordered_map<
+    Key, index_type, dash::detail::DefaultKeyHash<Key>, Pred> _overflow;
+  dash::detail::DefaultKeyHash<Key>       _key_hash;
+  Pred                                    _key_equal;
+};
+
+template <typename Key, typename Pred>
+constexpr typename UnorderedMapIndex<Key, Pred>::index_type
+  UnorderedMapIndex<Key, Pred>::npos;
+
+template <typename Key, typename Pred>
+constexpr typename UnorderedMapIndex<Key, Pred>::size_type
+  UnorderedMapIndex<Key, Pred>::bucket_size;
+
+} // namespace detail
+} // namespace dash
+
+#endif // DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
@@ -267,21 +267,21 @@ public:
     return nelem;
   }
 
+  /**
+   * Local element with the given key. Elements inserted concurrently
+   * since the last commit are not in the local iteration space and are
+   * not found.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    iterator found = std::find_if(
-                       first, last,
-                       [&](const value_type & v) {
-                         DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                        v.first, "==?", key);
-                         return pred(v.first, key);
-                       });
+    auto & first = begin();
+    auto & last  = end();
+    auto   lidx  = _map->_key_index.find_local(key);
+    iterator found = last;
+    if (lidx != map_type::key_index_type::npos && lidx < last.pos()) {
+      found = first + lidx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalRef.find >", found);
     return found;
   }
@@ -289,18 +289,13 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find() const", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    const_iterator found = std::find_if(
-                             first, last,
-                             [&](const value_type & v) {
-                               DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                              v.first, "==?", key);
-                               return pred(v.first, key);
-                             });
+    auto & first = begin();
+    auto & last  = end();
+    auto   lidx  = _map->_key_index.find_local(key);
+    const_iterator found = last;
+    if (lidx != map_type::key_index_type::npos && lidx < last.pos()) {
+      found = first + lidx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalRef.find const >", found);
     return found;
   }
@@ -315,6 +310,14 @@ public:
   {
     auto && key = value.first;
     DASH_LOG_DEBUG("UnorderedMapLocalRef.insert()", "key:", key);
+    if (_map->_concurrent_insert) {
+      // Slots in the local key index are claimed by other units, elements
+      // must be inserted using the global interface of the map:
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "attempted local insert of key " << key << " while concurrent " <<
+        "insertion is enabled");
+    }
     auto result = std::make_pair(_map->_lend, false);
 
     // Look up existing element at given key:
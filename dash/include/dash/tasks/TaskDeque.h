@@ -0,0 +1,72 @@
+#ifndef DASH__TASKS__TASK_DEQUE_H__INCLUDED
+#define DASH__TASKS__TASK_DEQUE_H__INCLUDED
+
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace dash {
+namespace tasks {
+namespace internal {
+
+/**
+ * Work-stealing deque of a worker thread.
+ *
+ * The owning thread pushes and pops tasks at the back of the deque, so it
+ * executes the most recently created tasks first, while other threads
+ * steal the oldest tasks from the front.
+ */
+template<typename TaskT>
+class TaskDeque
+{
+public:
+  void push(TaskT task)
+  {
+    std::lock_guard<std::mutex> lg(_mutex);
+    _tasks.push_back(std::move(task));
+  }
+
+  /**
+   * Take the most recently pushed task, called by the owning thread.
+   *
+   * \return  \c true if a task has been taken, \c false if the deque is
+   *          empty.
+   */
+  bool pop(TaskT & task)
+  {
+    std::lock_guard<std::mutex> lg(_mutex);
+    if (_tasks.empty()) {
+      return false;
+    }
+    task = std::move(_tasks.back());
+    _tasks.pop_back();
+    return true;
+  }
+
+  /**
+   * Take the oldest task, called by other threads.
+   *
+   * \return  \c true if a task has been taken, \c false if the deque is
+   *          empty or currently in use.
+   */
+  bool steal(TaskT & task)
+  {
+    std::unique_lock<std::mutex> lk(_mutex, std::try_to_lock);
+    if (!lk.owns_lock() || _tasks.empty()) {
+      return false;
+    }
+    task = std::move(_tasks.front());
+    _tasks.pop_front();
+    return true;
+  }
+
+private:
+  std::mutex        _mutex;
+  std::deque<TaskT> _tasks;
+};
+
+} // namespace internal
+} // namespace tasks
+} // namespace dash
+
+#endif // DASH__TASKS__TASK_DEQUE_H__INCLUDED
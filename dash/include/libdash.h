@@ -50,6 +50,9 @@ namespace dash {
 #include <dash/Algorithm.h>
 #include <dash/Atomic.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
+#include <dash/Aggregator.h>
+#include <dash/Tasks.h>
 
 #include <dash/Pattern.h>
 
@@ -3,6 +3,7 @@
 #include <dash/Team.h>
 #include <dash/Types.h>
 #include <dash/Shared.h>
+#include <dash/Tasks.h>
 
 #include <dash/util/Locality.h>
 #include <dash/util/Config.h>
@@ -81,6 +82,10 @@ void dash::finalize()
     return;
   }
 
+  // Stop worker threads of the task runtime:
+  DASH_LOG_DEBUG("dash::finalize", "finalize task runtime");
+  dash::tasks::internal::finalize();
+
   // Wait for all units:
   dash::barrier();
 
@@ -0,0 +1,77 @@
+#include <dash/SharedMutex.h>
+#include <dash/Exception.h>
+
+namespace dash {
+
+SharedMutex::SharedMutex(Team& team)
+  : _team(&team)
+{
+  init();
+}
+
+bool SharedMutex::init() {
+  if (_mutex) {
+    DASH_LOG_ERROR("DART reader-writer lock is already initialized");
+    return false;
+  }
+  if (*_team != dash::Team::Null() && dash::is_initialized()) {
+    dart_rwlock_t m;
+    dart_ret_t ret = dart_team_rwlock_init(_team->dart_id(), &m);
+
+    if (ret != DART_OK) {
+        DASH_LOG_ERROR(
+            "Failed to initialize DART reader-writer lock! "
+            "(dart_team_rwlock_init failed)");
+        return false;
+    }
+
+    _mutex.reset(m);
+    return true;
+  }
+
+  return false;
+}
+
+void SharedMutex::lock(){
+  DASH_ASSERT(_mutex);
+  dart_ret_t ret = dart_rwlock_acquire(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire failed");
+}
+
+bool SharedMutex::try_lock(){
+  int32_t result;
+
+  DASH_ASSERT(_mutex);
+  dart_ret_t ret = dart_rwlock_try_acquire(_mutex.get(), &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock(){
+  DASH_ASSERT(_mutex);
+  dart_ret_t ret = dart_rwlock_release(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release failed");
+}
+
+void SharedMutex::lock_shared(){
+  DASH_ASSERT(_mutex);
+  dart_ret_t ret = dart_rwlock_acquire_shared(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire_shared failed");
+}
+
+bool SharedMutex::try_lock_shared(){
+  int32_t result;
+
+  DASH_ASSERT(_mutex);
+  dart_ret_t ret = dart_rwlock_try_acquire_shared(_mutex.get(), &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire_shared failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock_shared(){
+  DASH_ASSERT(_mutex);
+  dart_ret_t ret = dart_rwlock_release_shared(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release_shared failed");
+}
+
+} // namespace dash
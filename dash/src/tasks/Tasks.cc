@@ -0,0 +1,579 @@
+#include <dash/Tasks.h>
+#include <dash/Init.h>
+#include <dash/Exception.h>
+
+#include <dash/tasks/TaskDeque.h>
+#include <dash/util/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_locality.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <thread>
+
+/**
+ * Message tag of tasks created on remote units.
+ */
+#define DART_TAG_TASKS 10017
+
+namespace dash {
+namespace tasks {
+namespace internal {
+
+namespace {
+
+/**
+ * Function that can be executed in tasks created by remote units.
+ */
+struct RemoteFunction
+{
+  remote_invoke_t   invoke;
+  void           (* func)(void);
+};
+
+/**
+ * Functions are sent to remote units as their index in this table. All
+ * units register the same functions in the same order, so indices are
+ * valid on every unit independent of where the functions are loaded.
+ */
+std::mutex                             remote_functions_mutex;
+std::vector<RemoteFunction>            remote_functions;
+std::map<void (*)(void), std::size_t>  remote_function_indices;
+
+std::size_t remote_function_index(void (*func)(void))
+{
+  std::lock_guard<std::mutex> lg(remote_functions_mutex);
+  auto it = remote_function_indices.find(func);
+  if (it == remote_function_indices.end()) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::tasks::async_at: function has not been registered with "
+      "dash::tasks::register_remote");
+  }
+  return it->second;
+}
+
+RemoteFunction remote_function(std::size_t index)
+{
+  std::lock_guard<std::mutex> lg(remote_functions_mutex);
+  DASH_ASSERT_LT(index, remote_functions.size(),
+                 "remote task function index out of range");
+  return remote_functions[index];
+}
+
+/**
+ * Header of a message containing a task created on a remote unit,
+ * followed by the argument of the task.
+ */
+struct RemoteTaskHeader
+{
+  std::size_t func_index;
+};
+
+/**
+ * Task dependency registered by a task that has not finished yet.
+ */
+struct DependencyRecord
+{
+  Dependency::Type      type;
+  dash::default_index_t begin;
+  dash::default_index_t end;
+  task_ptr_t            task;
+};
+
+/// Index of the deque of the calling thread, \c 0 for non-worker threads
+thread_local std::size_t this_worker = 0;
+
+} // namespace
+
+class Scheduler
+{
+private:
+  typedef std::pair<dart_team_t, int16_t>                   segment_key_t;
+  typedef std::map<segment_key_t, std::vector<DependencyRecord>>
+                                                            dependency_map_t;
+
+  struct RemoteMessage
+  {
+    dash::global_unit_t unit;
+    std::vector<char>   data;
+    dart_handle_t       handle = DART_HANDLE_NULL;
+  };
+
+public:
+  explicit Scheduler(std::size_t num_threads)
+  : _master(std::this_thread::get_id())
+  {
+    _deques.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i) {
+      _deques.emplace_back(new TaskDeque<task_ptr_t>());
+    }
+    for (std::size_t i = 1; i < num_threads; ++i) {
+      _workers.emplace_back(&Scheduler::worker_loop, this, i);
+    }
+    DASH_LOG_DEBUG("tasks::Scheduler()", "threads:", num_threads);
+  }
+
+  ~Scheduler()
+  {
+    _stop.store(true);
+    _idle_cv.notify_all();
+    for (auto & worker : _workers) {
+      worker.join();
+    }
+  }
+
+  std::size_t num_threads() const noexcept
+  {
+    return _deques.size();
+  }
+
+  bool is_master() const noexcept
+  {
+    return std::this_thread::get_id() == _master;
+  }
+
+  void spawn(task_ptr_t task, const Dependency * deps, std::size_t num_deps)
+  {
+    ++_num_pending;
+    if (num_deps > 0) {
+      std::lock_guard<std::mutex> lg(_deps_mutex);
+      for (std::size_t i = 0; i < num_deps; ++i) {
+        register_dependency(task, deps[i]);
+      }
+    }
+    release(std::move(task));
+  }
+
+  void spawn_remote(
+    dash::global_unit_t   unit,
+    void               (* func)(void),
+    const void          * arg,
+    std::size_t           nbytes)
+  {
+    RemoteMessage msg;
+    msg.unit = unit;
+    msg.data.resize(sizeof(RemoteTaskHeader) + nbytes);
+    RemoteTaskHeader header;
+    header.func_index = remote_function_index(func);
+    std::memcpy(msg.data.data(), &header, sizeof(header));
+    std::memcpy(msg.data.data() + sizeof(header), arg, nbytes);
+
+    if (unit == dash::myid()) {
+      spawn(make_remote_task(std::move(msg.data)), nullptr, 0);
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lg(_outbox_mutex);
+      _outbox.push_back(std::move(msg));
+    }
+    if (is_master()) {
+      flush_outbox();
+    }
+  }
+
+  /**
+   * Execute a single ready task.
+   *
+   * \return  \c true if a task has been executed, \c false if no task was
+   *          ready.
+   */
+  bool execute_one()
+  {
+    task_ptr_t task;
+    auto & own = *_deques[this_worker];
+    if (!own.pop(task)) {
+      auto num_deques = _deques.size();
+      for (std::size_t i = 1; i < num_deques; ++i) {
+        if (_deques[(this_worker + i) % num_deques]->steal(task)) {
+          break;
+        }
+      }
+    }
+    if (!task) {
+      return false;
+    }
+    run(std::move(task));
+    return true;
+  }
+
+  /**
+   * Send tasks created on remote units and receive tasks created by other
+   * units. Only called by the master thread.
+   */
+  void progress()
+  {
+    if (!is_master()) {
+      return;
+    }
+    flush_outbox();
+    for (;;) {
+      dart_global_unit_t unit;
+      size_t             nbytes;
+      int32_t            flag = 0;
+      DASH_ASSERT_RETURNS(
+        dart_probe(DART_TAG_TASKS, &unit, &nbytes, &flag),
+        DART_OK);
+      if (!flag) {
+        break;
+      }
+      std::vector<char> data(nbytes);
+      DASH_ASSERT_RETURNS(
+        dart_recv(data.data(), nbytes, DART_TYPE_BYTE, DART_TAG_TASKS, unit),
+        DART_OK);
+      ++_num_received;
+      spawn(make_remote_task(std::move(data)), nullptr, 0);
+    }
+  }
+
+  void yield()
+  {
+    progress();
+    if (!execute_one()) {
+      std::this_thread::yield();
+    }
+  }
+
+  void wait(const Task & task)
+  {
+    while (!task.done.load(std::memory_order_acquire)) {
+      yield();
+    }
+  }
+
+  /**
+   * Execute tasks until all tasks created on this unit have finished.
+   */
+  void wait_all()
+  {
+    for (;;) {
+      progress();
+      if (_num_pending.load() == 0) {
+        // tasks that finished after the last progress may have created
+        // remote tasks
+        flush_outbox();
+        return;
+      }
+      if (!execute_one()) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void complete()
+  {
+    if (!is_master()) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "dash::tasks::complete must be called by the thread that created "
+        "the first task");
+    }
+    // Terminate once no unit has a send in flight and the number of remote
+    // tasks sent by all units equals the number of remote tasks received
+    // and executed by all units:
+    long long counts[3];
+    long long total[3];
+    do {
+      wait_all();
+      counts[0] = _num_sent;
+      counts[1] = _num_received;
+      counts[2] = _in_flight.size();
+      DASH_ASSERT_RETURNS(
+        dart_allreduce(counts, total, 3, DART_TYPE_LONGLONG, DART_OP_SUM,
+                       DART_TEAM_ALL),
+        DART_OK);
+    } while (total[0] != total[1] || total[2] != 0);
+  }
+
+private:
+  void worker_loop(std::size_t id)
+  {
+    this_worker = id;
+    int idle_rounds = 0;
+    while (!_stop.load(std::memory_order_relaxed)) {
+      if (execute_one()) {
+        idle_rounds = 0;
+        continue;
+      }
+      if (++idle_rounds < 64) {
+        std::this_thread::yield();
+        continue;
+      }
+      std::unique_lock<std::mutex> lk(_idle_mutex);
+      ++_num_idle;
+      _idle_cv.wait_for(lk, std::chrono::milliseconds(1));
+      --_num_idle;
+    }
+  }
+
+  void enqueue(task_ptr_t task)
+  {
+    _deques[this_worker]->push(std::move(task));
+    if (_num_idle.load(std::memory_order_relaxed) > 0) {
+      _idle_cv.notify_one();
+    }
+  }
+
+  /**
+   * Release a reference on the predecessor count of the task and enqueue
+   * it once all predecessors have finished.
+   */
+  void release(task_ptr_t task)
+  {
+    if (task->num_predecessors.fetch_sub(1) == 1) {
+      enqueue(std::move(task));
+    }
+  }
+
+  void run(task_ptr_t task)
+  {
+    task->func();
+    // release resources captured by the task function
+    task->func = nullptr;
+
+    std::vector<task_ptr_t> successors;
+    {
+      std::lock_guard<std::mutex> lg(task->mutex);
+      task->done.store(true, std::memory_order_release);
+      successors.swap(task->successors);
+    }
+    for (auto & succ : successors) {
+      release(std::move(succ));
+    }
+    --_num_pending;
+  }
+
+  static void add_edge(Task & pred, const task_ptr_t & succ)
+  {
+    std::lock_guard<std::mutex> lg(pred.mutex);
+    if (!pred.done.load(std::memory_order_relaxed)) {
+      ++succ->num_predecessors;
+      pred.successors.push_back(succ);
+    }
+  }
+
+  void register_dependency(const task_ptr_t & task, const Dependency & dep)
+  {
+    auto & records = _deps[segment_key_t(dep.teamid(), dep.segid())];
+
+    records.erase(
+      std::remove_if(records.begin(), records.end(),
+        [](const DependencyRecord & rec) {
+          return rec.task->done.load(std::memory_order_relaxed);
+        }),
+      records.end());
+
+    for (auto & rec : records) {
+      if (rec.begin < dep.end() && dep.begin() < rec.end &&
+          rec.task != task &&
+          (rec.type == Dependency::Type::Out ||
+           dep.type() == Dependency::Type::Out)) {
+        add_edge(*rec.task, task);
+      }
+    }
+    if (dep.type() == Dependency::Type::Out) {
+      // subsequent tasks depending on records covered by this dependency
+      // are ordered after them through this task
+      records.erase(
+        std::remove_if(records.begin(), records.end(),
+          [&](const DependencyRecord & rec) {
+            return dep.begin() <= rec.begin && rec.end <= dep.end();
+          }),
+        records.end());
+    }
+    records.push_back(
+      DependencyRecord { dep.type(), dep.begin(), dep.end(), task });
+  }
+
+  task_ptr_t make_remote_task(std::vector<char> && data)
+  {
+    return std::make_shared<Task>(
+      [data = std::move(data)]() {
+        RemoteTaskHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        auto remote = remote_function(header.func_index);
+        remote.invoke(remote.func, data.data() + sizeof(header));
+      });
+  }
+
+  void flush_outbox()
+  {
+    std::vector<RemoteMessage> outbox;
+    {
+      std::lock_guard<std::mutex> lg(_outbox_mutex);
+      outbox.swap(_outbox);
+    }
+    // Sends must not block, the target may be waiting in the collective
+    // of complete() and not receive before this unit joins it:
+    for (auto & msg : outbox) {
+      DASH_ASSERT_RETURNS(
+        dart_isend(msg.data.data(), msg.data.size(), DART_TYPE_BYTE,
+                   DART_TAG_TASKS, msg.unit, &msg.handle),
+        DART_OK);
+      _in_flight.push_back(std::move(msg));
+    }
+    test_sends();
+  }
+
+  /**
+   * Count completed sends and release their message buffers.
+   */
+  void test_sends()
+  {
+    auto sent = std::remove_if(
+                  _in_flight.begin(), _in_flight.end(),
+                  [this](RemoteMessage & msg) {
+                    int32_t flag = 0;
+                    DASH_ASSERT_RETURNS(
+                      dart_test(&msg.handle, &flag),
+                      DART_OK);
+                    if (flag) {
+                      ++_num_sent;
+                    }
+                    return flag != 0;
+                  });
+    _in_flight.erase(sent, _in_flight.end());
+  }
+
+private:
+  std::thread::id                                       _master;
+  std::vector<std::unique_ptr<TaskDeque<task_ptr_t>>>   _deques;
+  std::vector<std::thread>                              _workers;
+  std::atomic<bool>                                     _stop{false};
+  /// Number of tasks created on this unit that have not finished
+  std::atomic<long long>                                _num_pending{0};
+
+  std::mutex                                            _idle_mutex;
+  std::condition_variable                               _idle_cv;
+  std::atomic<int>                                      _num_idle{0};
+
+  std::mutex                                            _deps_mutex;
+  dependency_map_t                                      _deps;
+
+  std::mutex                                            _outbox_mutex;
+  std::vector<RemoteMessage>                            _outbox;
+  /// Messages with sends in progress, only accessed by the master thread
+  std::vector<RemoteMessage>                            _in_flight;
+  /// Number of remote tasks sent, only accessed by the master thread
+  long long                                             _num_sent     = 0;
+  /// Number of remote tasks received, only accessed by the master thread
+  long long                                             _num_received = 0;
+};
+
+namespace {
+
+std::mutex                 scheduler_mutex;
+std::atomic<Scheduler *>   scheduler_instance{nullptr};
+
+std::size_t default_num_threads()
+{
+  auto num_threads = dash::util::Config::get<int>("DASH_NUM_THREADS");
+  if (num_threads > 0) {
+    return num_threads;
+  }
+  dart_unit_locality_t * uloc;
+  if (dart_unit_locality(
+        DART_TEAM_ALL, dart_team_unit_t { dash::myid().id }, &uloc)
+        == DART_OK && uloc->hwinfo.num_cores > 0) {
+    return uloc->hwinfo.num_cores;
+  }
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+Scheduler & scheduler()
+{
+  auto sched = scheduler_instance.load(std::memory_order_acquire);
+  if (sched == nullptr) {
+    std::lock_guard<std::mutex> lg(scheduler_mutex);
+    sched = scheduler_instance.load(std::memory_order_relaxed);
+    if (sched == nullptr) {
+      sched = new Scheduler(default_num_threads());
+      scheduler_instance.store(sched, std::memory_order_release);
+    }
+  }
+  return *sched;
+}
+
+} // namespace
+
+void spawn(
+  task_ptr_t         task,
+  const Dependency * deps,
+  std::size_t        num_deps)
+{
+  scheduler().spawn(std::move(task), deps, num_deps);
+}
+
+std::size_t register_remote(
+  remote_invoke_t       invoke,
+  void               (* func)(void))
+{
+  std::lock_guard<std::mutex> lg(remote_functions_mutex);
+  auto it = remote_function_indices.find(func);
+  if (it != remote_function_indices.end()) {
+    return it->second;
+  }
+  remote_functions.push_back(RemoteFunction { invoke, func });
+  remote_function_indices[func] = remote_functions.size() - 1;
+  return remote_functions.size() - 1;
+}
+
+void spawn_remote(
+  dash::global_unit_t   unit,
+  void               (* func)(void),
+  const void          * arg,
+  std::size_t           nbytes)
+{
+  scheduler().spawn_remote(unit, func, arg, nbytes);
+}
+
+void wait(const Task & task)
+{
+  scheduler().wait(task);
+}
+
+bool test(const Task & task)
+{
+  if (task.done.load(std::memory_order_acquire)) {
+    return true;
+  }
+  scheduler().yield();
+  return task.done.load(std::memory_order_acquire);
+}
+
+void finalize()
+{
+  std::lock_guard<std::mutex> lg(scheduler_mutex);
+  auto sched = scheduler_instance.load(std::memory_order_relaxed);
+  if (sched != nullptr) {
+    DASH_LOG_DEBUG("tasks::finalize()");
+    sched->wait_all();
+    delete sched;
+    scheduler_instance.store(nullptr, std::memory_order_release);
+  }
+}
+
+} // namespace internal
+
+void yield()
+{
+  internal::scheduler().yield();
+}
+
+void complete()
+{
+  internal::scheduler().complete();
+}
+
+std::size_t num_threads()
+{
+  return internal::scheduler().num_threads();
+}
+
+} // namespace tasks
+} // namespace dash
@@ -271,3 +271,28 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, TestFindArrayAsync)
+{
+  int num_elem        = dash::Team::All().size() * 10;
+  Element_t min_value = 11;
+  Array_t array(num_elem);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = 100 + dash::myid() * 10 + li;
+  }
+  array.barrier();
+  index_t min_pos = array.size() / 2;
+  if (dash::myid() == 0) {
+    array[min_pos] = min_value;
+  }
+  array.barrier();
+
+  auto fut = dash::min_element_async(array.begin(), array.end());
+  auto found_gptr = fut.get();
+  EXPECT_EQ_U(array.begin() + min_pos, found_gptr);
+  EXPECT_EQ(min_value, static_cast<Element_t>(*found_gptr));
+
+  // empty range
+  auto fut_empty = dash::min_element_async(array.begin(), array.begin());
+  EXPECT_EQ_U(array.begin(), fut_empty.get());
+}
@@ -154,3 +154,29 @@ TEST_F(ReduceTest, LocalStdIterator) {
 
   ASSERT_EQ_U(((dash::size()-1)*(dash::size())/2) * (1 + 2 + 3)  + 1, result);
 }
+
+TEST_F(ReduceTest, Async) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  auto value = 2, start = 10;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  dash::fill(target.begin(), target.end(), value);
+
+  dash::barrier();
+
+  auto fut = dash::reduce_async(target.begin(), target.end(), start);
+  auto fut_local = dash::reduce_async(target.lbegin(), target.lend(), 0,
+                                      dash::plus<int>(), true);
+
+  ASSERT_EQ_U(num_elem_total * value, fut_local.get());
+  ASSERT_EQ_U(num_elem_total * value + start, fut.get());
+
+  // custom reduction operation
+  auto fut_max = dash::reduce_async(
+                   target.begin(), target.end(), 0,
+                   [](int a, int b) { return std::max(a, b); });
+  while (!fut_max.test()) { }
+  ASSERT_EQ_U(value, fut_max.get());
+}
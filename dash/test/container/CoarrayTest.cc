@@ -9,9 +9,11 @@
 #include <dash/util/TeamLocality.h>
 
 // for std::lock_guard
+#include <chrono>
 #include <mutex>
 #include <thread>
 #include <random>
+#include <vector>
 
 using namespace dash::coarray;
 
@@ -236,6 +238,53 @@ TEST_F(CoarrayTest, Synchronization)
   }
 }
 
+TEST_F(CoarrayTest, SyncImagesSplitPhase)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+  dash::Coarray<int> x;
+  x = 0;
+  dash::barrier();
+
+  // unordered image IDs with duplicates
+  std::vector<int> images;
+  for(int i = num_images() - 1; i >= 0; --i){
+    images.push_back(i);
+    images.push_back(i);
+  }
+
+  for(int round = 1; round <= 3; ++round){
+    x = static_cast<int>(this_image()) + round;
+    sync_images_begin(images);
+    // nothing to overlap with in this test
+    sync_images_end(images);
+    for(int i = 0; i < num_images(); ++i){
+      ASSERT_EQ_U(i + round, static_cast<int>(x(i)));
+    }
+    sync_images(images);
+  }
+
+  // subset of even images, the last one arrives late
+  std::vector<int> even;
+  for(int i = 0; i < num_images(); i += 2){
+    even.push_back(i);
+  }
+  std::chrono::time_point<std::chrono::steady_clock> start, end;
+  start = std::chrono::steady_clock::now();
+  if(this_image() == even.back()){
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  }
+  sync_images(even);
+  end = std::chrono::steady_clock::now();
+  int elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>
+                      (end-start).count();
+  if(this_image() % 2 == 0){
+    ASSERT_GE_U(elapsed_ms, 190);
+  }
+  dash::barrier();
+}
+
 TEST_F(CoarrayTest, Iterators)
 {
   dash::Coarray<int>         i;
@@ -528,6 +577,38 @@ TEST_F(CoarrayTest, CoEvent)
   }
 }
 
+TEST_F(CoarrayTest, CoEventWaitFor)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+  std::vector<dash::Coevent> events(2);
+
+  // no event was posted
+  ASSERT_EQ_U(false, events[0].wait_for(std::chrono::milliseconds(1)));
+  ASSERT_EQ_U(events.end(),
+              dash::Coevent::test_any(events.begin(), events.end()));
+  dash::barrier();
+
+  // every unit posts an event to its right neighbor
+  auto right = (static_cast<int>(this_image()) + 1) % num_images();
+  events[1](right).post();
+  ASSERT_TRUE(events[1].wait_until(
+                std::chrono::steady_clock::now() + std::chrono::seconds(60)));
+  dash::barrier();
+
+  events[1](right).post();
+  dash::barrier();
+  ASSERT_EQ_U(events.begin() + 1,
+              dash::Coevent::test_any(events.begin(), events.end()));
+  // not consumed by test_any
+  ASSERT_EQ_U(1, events[1].test());
+  ASSERT_EQ_U(false, events[1].wait_for(std::chrono::milliseconds(1), 2));
+  ASSERT_EQ_U(true,  events[1].wait_for(std::chrono::milliseconds(1)));
+  ASSERT_EQ_U(0, events[1].test());
+  dash::barrier();
+}
+
 TEST_F(CoarrayTest, CoEventIter)
 {
   if(num_images() < 3){
@@ -543,3 +543,404 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+TEST_F(UnorderedMapTest, IndexedLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits = dash::size();
+  int myid   = dash::myid().id;
+  // Exceeds the initial capacity of the key index, which has to be
+  // resized in map.barrier():
+  int local_elements = 200;
+
+  map_t map(0, 8);
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = nunits * li + myid;
+    auto insertion = map.local.insert(map_value({ key, 0.5 * key }));
+    EXPECT_TRUE_U(insertion.second);
+    // Uncommitted local elements are found immediately:
+    EXPECT_NE_U(map.end(), map.find(key));
+    EXPECT_NE_U(map.local.end(), map.local.find(key));
+  }
+
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  // Look up keys of all units, starting at a different unit at every unit
+  // to vary the accessed index partitions:
+  for (int li = 0; li < local_elements; ++li) {
+    for (int u = 0; u < nunits; ++u) {
+      int   unit   = (myid + u) % nunits;
+      key_t key    = nunits * li + unit;
+      auto  found  = map.find(key);
+      ASSERT_NE_U(map.end(), found);
+      map_value value = *found;
+      EXPECT_EQ_U(key,       value.first);
+      EXPECT_EQ_U(0.5 * key, value.second);
+    }
+  }
+
+  // Absent keys:
+  for (int li = local_elements; li < 2 * local_elements; ++li) {
+    key_t key = nunits * li + myid;
+    EXPECT_EQ_U(map.end(), map.find(key));
+    EXPECT_EQ_U(0,         map.count(key));
+    EXPECT_EQ_U(map.local.end(), map.local.find(key));
+  }
+
+  dash::barrier();
+}
+
+TEST_F(UnorderedMapTest, BulkOperations)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits = dash::size();
+  int myid   = dash::myid().id;
+  int nlocal = 100;
+  // Keys of neighboring units overlap by half:
+  int nkeys  = (nunits + 1) * nlocal / 2;
+
+  map_t map(0, 8);
+
+  std::vector<map_value> values;
+  for (int li = 0; li < nlocal; ++li) {
+    key_t key = myid * nlocal / 2 + li;
+    values.push_back(map_value(key, 2.0 * key));
+  }
+  map.insert_bulk(values.begin(), values.end());
+
+  EXPECT_EQ_U(nkeys, map.size());
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, value.first % nunits);
+  }
+
+  std::vector<key_t> keys;
+  for (key_t key = 0; key < nkeys + 10; ++key) {
+    keys.push_back(key);
+  }
+  std::vector<map_iterator> found;
+  map.find_bulk(keys.begin(), keys.end(), std::back_inserter(found));
+  ASSERT_EQ_U(keys.size(), found.size());
+  for (key_t key = 0; key < nkeys + 10; ++key) {
+    if (key < nkeys) {
+      ASSERT_NE_U(map.end(), found[key]);
+      map_value value = *found[key];
+      EXPECT_EQ_U(key,       value.first);
+      EXPECT_EQ_U(2.0 * key, value.second);
+      EXPECT_EQ_U(map.find(key), found[key]);
+    } else {
+      EXPECT_EQ_U(map.end(), found[key]);
+    }
+  }
+
+  // Erase keys divisible by 3, keys of neighbors are erased twice:
+  std::vector<key_t> erase_keys;
+  for (const auto & value : values) {
+    if (value.first % 3 == 0) {
+      erase_keys.push_back(value.first);
+    }
+  }
+  map.erase_bulk(erase_keys.begin(), erase_keys.end());
+
+  EXPECT_EQ_U(nkeys - (nkeys + 2) / 3, map.size());
+  found.clear();
+  map.find_bulk(keys.begin(), keys.end(), std::back_inserter(found));
+  for (key_t key = 0; key < nkeys; ++key) {
+    if (key % 3 == 0) {
+      EXPECT_EQ_U(map.end(), found[key]);
+      EXPECT_EQ_U(0, map.count(key));
+    } else {
+      ASSERT_NE_U(map.end(), found[key]);
+      map_value value = *found[key];
+      EXPECT_EQ_U(key,       value.first);
+      EXPECT_EQ_U(2.0 * key, value.second);
+    }
+  }
+
+  dash::barrier();
+}
+
+TEST_F(UnorderedMapTest, BulkInsertLocalHash)
+{
+  typedef int                                  key_t;
+  typedef double                               mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  int nunits = dash::size();
+  int myid   = dash::myid().id;
+  int nlocal = 50;
+
+  map_t map;
+
+  std::vector<map_value> values;
+  for (int li = 0; li < nlocal; ++li) {
+    values.push_back(map_value(myid * nlocal + li, 1.0 * myid));
+  }
+  map.insert_bulk(values.begin(), values.end());
+
+  EXPECT_EQ_U(nunits * nlocal, map.size());
+  EXPECT_EQ_U(nlocal,          map.lsize());
+
+  // Keys inserted by the next unit already exist at that unit:
+  values.clear();
+  int next = (myid + 1) % nunits;
+  for (int li = 0; li < nlocal; ++li) {
+    values.push_back(map_value(next * nlocal + li, -1.0));
+  }
+  map.insert_bulk(values.begin(), values.end());
+
+  EXPECT_EQ_U(nunits * nlocal, map.size());
+  EXPECT_EQ_U(nlocal,          map.lsize());
+  for (const auto & value : values) {
+    auto found = map.find(value.first);
+    ASSERT_NE_U(map.end(), found);
+    map_value existing = *found;
+    EXPECT_EQ_U(1.0 * next, existing.second);
+  }
+
+  dash::barrier();
+}
+
+TEST_F(UnorderedMapTest, BulkInsertLocalHashDuplicates)
+{
+  typedef int                                  key_t;
+  typedef double                               mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  int nunits = dash::size();
+  int myid   = dash::myid().id;
+
+  map_t map;
+
+  // Every unit inserts key 42, its own key and the key of the next unit:
+  int next = (myid + 1) % nunits;
+  std::vector<map_value> values;
+  values.push_back(map_value(42, 1.0 * myid));
+  values.push_back(map_value(100 + myid, 1.0 * myid));
+  values.push_back(map_value(100 + next, 1.0 * myid));
+  map.insert_bulk(values.begin(), values.end());
+
+  EXPECT_EQ_U(nunits + 1, map.size());
+  // Duplicates are stored at the lowest inserting unit:
+  int prev = (myid + nunits - 1) % nunits;
+  std::vector<int> lkeys;
+  if (myid == 0) {
+    lkeys.push_back(42);
+  }
+  if (nunits == 1 || myid < prev) {
+    lkeys.push_back(100 + myid);
+  }
+  if (nunits > 1 && myid < next) {
+    lkeys.push_back(100 + next);
+  }
+  EXPECT_EQ_U(lkeys.size(), map.lsize());
+  for (auto key : lkeys) {
+    EXPECT_NE_U(map.local.end(), map.local.find(key));
+  }
+  map_value found_42 = *map.find(42);
+  EXPECT_EQ_U(0.0, found_42.second);
+
+  dash::barrier();
+}
+
+template<typename HashT>
+static void check_hash_policy_balance(HashT hash)
+{
+  int  nunits = dash::size();
+  int  nkeys  = 10000;
+  std::vector<int> nkeys_unit(nunits, 0);
+  for (int key = 0; key < nkeys; ++key) {
+    auto unit = hash(key);
+    ASSERT_GE_U(unit.id, 0);
+    ASSERT_LT_U(unit.id, nunits);
+    EXPECT_EQ_U(unit, hash(key));
+    ++nkeys_unit[unit];
+  }
+  for (int u = 0; u < nunits; ++u) {
+    EXPECT_GT_U(nkeys_unit[u], (nkeys / nunits) * 7 / 10);
+    EXPECT_LT_U(nkeys_unit[u], (nkeys / nunits) * 13 / 10);
+  }
+}
+
+TEST_F(UnorderedMapTest, HashPolicies)
+{
+  check_hash_policy_balance(dash::HashModulo<int>(dash::Team::All()));
+  check_hash_policy_balance(dash::HashJump<int>(dash::Team::All()));
+
+  dash::HashNodeFirst<int> node_hash(dash::Team::All());
+  EXPECT_GE_U(node_hash.num_nodes(), 1);
+  EXPECT_LE_U(node_hash.num_nodes(), dash::size());
+  if (node_hash.num_nodes() == 1) {
+    check_hash_policy_balance(node_hash);
+  }
+
+  // Growing the number of buckets from n to n+1 only moves hash values to
+  // the new bucket:
+  for (int32_t nbuckets = 1; nbuckets < 16; ++nbuckets) {
+    for (uint64_t hash = 0; hash < 1000; ++hash) {
+      auto b_old = dash::detail::jump_consistent_hash(hash, nbuckets);
+      auto b_new = dash::detail::jump_consistent_hash(hash, nbuckets + 1);
+      EXPECT_TRUE_U(b_new == b_old || b_new == nbuckets);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, RemoteInsert)
+{
+  typedef int                                                key_t;
+  typedef double                                             mapped_t;
+  typedef dash::HashModulo<key_t>                            hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>        map_t;
+  typedef typename map_t::value_type                         map_value;
+
+  int nunits = dash::size();
+  int myid   = dash::myid().id;
+  int nlocal = 100;
+
+  map_t  map(0, 8);
+  hash_t hash(dash::Team::All());
+
+  for (int li = 0; li < nlocal; ++li) {
+    key_t key = myid * nlocal + li;
+    auto insertion = map.insert(map_value(key, 0.5 * key));
+    EXPECT_TRUE_U(insertion.second);
+    // Elements inserted for remote units are found before commit:
+    ASSERT_NE_U(map.end(), map.find(key));
+    map_value value = *map.find(key);
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * nlocal, map.size());
+  // Elements have been moved to the unit of their key:
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, hash(value.first));
+  }
+  for (key_t key = 0; key < nunits * nlocal; ++key) {
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(key,       value.first);
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+  EXPECT_EQ_U(map.end(), map.find(nunits * nlocal));
+
+  dash::barrier();
+}
+
+TEST_F(UnorderedMapTest, ConcurrentInsert)
+{
+  typedef int                                                key_t;
+  typedef double                                             mapped_t;
+  typedef dash::HashModulo<key_t>                            hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>        map_t;
+  typedef typename map_t::value_type                         map_value;
+
+  int nunits = dash::size();
+  int myid   = dash::myid().id;
+  int nlocal = 100;
+
+  map_t  map(2 * nunits * nlocal, 8);
+  hash_t hash(dash::Team::All());
+
+  map.set_concurrent_insert(true);
+  EXPECT_TRUE_U(map.concurrent_insert());
+
+  // All units insert the same key concurrently:
+  map.insert(map_value(-1, myid));
+  for (int li = 0; li < nlocal; ++li) {
+    key_t key = myid * nlocal + li;
+    auto insertion = map.insert(map_value(key, 0.5 * key));
+    EXPECT_TRUE_U(insertion.second);
+    ASSERT_NE_U(map.end(), insertion.first);
+    map_value value = *insertion.first;
+    EXPECT_EQ_U(key,       value.first);
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+  dash::Team::All().barrier();
+  for (key_t key = 0; key < nunits * nlocal; ++key) {
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(key,       value.first);
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+  EXPECT_EQ_U(map.end(), map.find(nunits * nlocal));
+  EXPECT_THROW(
+    map.local.insert(map_value(nunits * nlocal + myid, 0)),
+    dash::exception::RuntimeError);
+  map[nunits * nlocal + myid] = 0.5 * myid;
+  auto existing = map.insert(map_value(myid * nlocal, -1.0));
+  EXPECT_FALSE_U(existing.second);
+  map_value existing_value = *existing.first;
+  EXPECT_EQ_U(0.5 * myid * nlocal, existing_value.second);
+  dash::Team::All().barrier();
+
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * nlocal + nunits + 1, map.size());
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, hash(value.first));
+  }
+  for (key_t key = 0; key < nunits * nlocal; ++key) {
+    map_value value = *map.find(key);
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+  for (int u = 0; u < nunits; ++u) {
+    map_value value = *map.find(nunits * nlocal + u);
+    EXPECT_EQ_U(0.5 * u, value.second);
+  }
+  map_value shared = *map.find(-1);
+  EXPECT_GE_U(shared.second, 0);
+  EXPECT_LT_U(shared.second, nunits);
+
+  // Elements exceeding the capacity reserved at their unit are inserted
+  // in the next commit:
+  map_t small_map(0, 8);
+  small_map.set_concurrent_insert(true);
+  for (int li = 0; li < nlocal; ++li) {
+    key_t key = myid * nlocal + li;
+    EXPECT_TRUE_U(small_map.insert(map_value(key, 0.5 * key)).second);
+  }
+  // Writes to references to deferred elements are applied in the commit:
+  for (int li = 0; li < nlocal; ++li) {
+    key_t key = (nunits + myid) * nlocal + li;
+    small_map[key] = -1.0;
+    small_map[key] = 0.5 * key;
+  }
+  small_map.set_concurrent_insert(false);
+  EXPECT_FALSE_U(small_map.concurrent_insert());
+  EXPECT_EQ_U(2 * nunits * nlocal, small_map.size());
+  for (key_t key = 0; key < 2 * nunits * nlocal; ++key) {
+    auto found = small_map.find(key);
+    ASSERT_NE_U(small_map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+
+  // Concurrent insertion requires elements to be placed by key:
+  dash::UnorderedMap<key_t, mapped_t> local_map;
+  EXPECT_THROW(
+    local_map.set_concurrent_insert(true),
+    dash::exception::InvalidArgument);
+
+  dash::barrier();
+}
@@ -3,6 +3,8 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <array>
+
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
   // we need an even amount of participating units
@@ -211,3 +213,182 @@ TEST_F(DARTCollectiveTest, MaxElementAt) {
   dart_op_destroy(&new_op);
 
 }
+
+TEST_F(DARTCollectiveTest, NonBlocking) {
+
+  using elem_t = int;
+  auto     team  = dash::Team::All().dart_id();
+  size_t   size  = dash::size();
+  elem_t   value = dash::myid() + 1;
+
+  std::vector<dart_handle_t> handles(4, DART_HANDLE_NULL);
+
+  elem_t sum = 0;
+  ASSERT_EQ_U(DART_OK,
+    dart_iallreduce(
+      &value, &sum, 1, dash::dart_datatype<elem_t>::value,
+      DART_OP_SUM, team, &handles[0]));
+
+  elem_t bcast = (dash::myid() == 0) ? 42 : 0;
+  ASSERT_EQ_U(DART_OK,
+    dart_ibcast(
+      &bcast, 1, dash::dart_datatype<elem_t>::value,
+      dash::team_unit_t(0), team, &handles[1]));
+
+  std::vector<elem_t> gathered(size);
+  ASSERT_EQ_U(DART_OK,
+    dart_iallgather(
+      &value, gathered.data(), 1, dash::dart_datatype<elem_t>::value,
+      team, &handles[2]));
+
+  std::vector<elem_t> sendbuf(size);
+  std::vector<elem_t> recvbuf(size);
+  for (size_t i = 0; i < size; ++i) {
+    sendbuf[i] = dash::myid() * size + i;
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_ialltoall(
+      sendbuf.data(), recvbuf.data(), 1,
+      dash::dart_datatype<elem_t>::value, team, &handles[3]));
+
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles.data(), handles.size()));
+
+  ASSERT_EQ_U(size * (size + 1) / 2, sum);
+  ASSERT_EQ_U(42, bcast);
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_EQ_U(i + 1, gathered[i]);
+    ASSERT_EQ_U(i * size + dash::myid(), recvbuf[i]);
+  }
+
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK, dart_ibarrier(team, &handle));
+  int32_t finished = 0;
+  while (!finished) {
+    ASSERT_EQ_U(DART_OK, dart_test(&handle, &finished));
+  }
+  ASSERT_EQ_U(DART_HANDLE_NULL, handle);
+}
+
+TEST_F(DARTCollectiveTest, NonBlockingV) {
+
+  using elem_t = int;
+  auto   team  = dash::Team::All().dart_id();
+  size_t size  = dash::size();
+  size_t myid  = dash::myid();
+
+  // unit u contributes u+1 elements to the allgatherv and sends u+1
+  // elements to every unit in the alltoallv
+  std::vector<size_t> counts(size), displs(size);
+  size_t total = 0;
+  for (size_t u = 0; u < size; ++u) {
+    counts[u] = u + 1;
+    displs[u] = total;
+    total    += counts[u];
+  }
+  std::vector<elem_t> sendbuf(myid + 1, myid);
+  std::vector<elem_t> gathered(total);
+
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK,
+    dart_iallgatherv(
+      sendbuf.data(), sendbuf.size(), dash::dart_datatype<elem_t>::value,
+      gathered.data(), counts.data(), displs.data(), team, &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(&handle));
+
+  for (size_t u = 0; u < size; ++u) {
+    for (size_t i = 0; i < counts[u]; ++i) {
+      ASSERT_EQ_U(u, gathered[displs[u] + i]);
+    }
+  }
+
+  std::vector<size_t> scounts(size, myid + 1), sdispls(size);
+  for (size_t u = 0; u < size; ++u) {
+    sdispls[u] = u * (myid + 1);
+  }
+  std::vector<elem_t> a2a_send(size * (myid + 1), myid);
+  std::vector<elem_t> a2a_recv(total);
+  ASSERT_EQ_U(DART_OK,
+    dart_ialltoallv(
+      a2a_send.data(), scounts.data(), sdispls.data(),
+      dash::dart_datatype<elem_t>::value,
+      a2a_recv.data(), counts.data(), displs.data(), team, &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(&handle));
+
+  ASSERT_EQ(gathered, a2a_recv);
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+
+  using elem_t = int;
+  size_t size  = dash::size();
+  size_t myid  = dash::myid();
+
+  // every unit sends u+1 elements to unit u
+  std::vector<size_t> send_counts(size), send_displs(size);
+  std::vector<size_t> recv_counts(size, myid + 1), recv_displs(size);
+  size_t nsend = 0;
+  for (size_t u = 0; u < size; ++u) {
+    send_counts[u] = u + 1;
+    send_displs[u] = nsend;
+    recv_displs[u] = u * (myid + 1);
+    nsend         += send_counts[u];
+  }
+  std::vector<elem_t> sendbuf(nsend, myid);
+  std::vector<elem_t> recvbuf(size * (myid + 1), -1);
+
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoallv(
+      sendbuf.data(), send_counts.data(), send_displs.data(),
+      dash::dart_datatype<elem_t>::value,
+      recvbuf.data(), recv_counts.data(), recv_displs.data(),
+      dash::Team::All().dart_id()));
+
+  for (size_t u = 0; u < size; ++u) {
+    for (size_t i = 0; i < recv_counts[u]; ++i) {
+      ASSERT_EQ_U(u, recvbuf[recv_displs[u] + i]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, Scan) {
+
+  using elem_t = int;
+  size_t myid  = dash::myid();
+  std::array<elem_t, 2> value = {{ static_cast<elem_t>(myid + 1), 1 }};
+  std::array<elem_t, 2> result;
+
+  ASSERT_EQ_U(DART_OK,
+    dart_scan(
+      value.data(), result.data(), value.size(),
+      dash::dart_datatype<elem_t>::value, DART_OP_SUM,
+      dash::Team::All().dart_id()));
+  ASSERT_EQ_U((myid + 1) * (myid + 2) / 2, result[0]);
+  ASSERT_EQ_U(myid + 1, result[1]);
+
+  ASSERT_EQ_U(DART_OK,
+    dart_exscan(
+      value.data(), result.data(), value.size(),
+      dash::dart_datatype<elem_t>::value, DART_OP_SUM,
+      dash::Team::All().dart_id()));
+  if (myid > 0) {
+    ASSERT_EQ_U(myid * (myid + 1) / 2, result[0]);
+    ASSERT_EQ_U(myid, result[1]);
+  }
+
+  // prefix reduction using a custom operation
+  dart_operation_t new_op;
+  elem_t cutoff = dash::size() / 2;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_op_create(
+      &reduce_max_fn<elem_t>, &cutoff, true,
+      dash::dart_datatype<elem_t>::value, false, &new_op));
+  elem_t max;
+  elem_t id = myid;
+  ASSERT_EQ_U(DART_OK,
+    dart_scan(
+      &id, &max, 1, dash::dart_datatype<elem_t>::value, new_op,
+      dash::Team::All().dart_id()));
+  ASSERT_EQ_U(std::min<elem_t>(myid, cutoff), max);
+  dart_op_destroy(&new_op);
+}
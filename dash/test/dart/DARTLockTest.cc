@@ -1,8 +1,14 @@
 #include "DARTLockTest.h"
 
+#include <dash/Array.h>
 #include <dash/Shared.h>
+#include <dash/SharedMutex.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/dart/if/dart.h>
 
+#include <mutex>
+#include <shared_mutex>
+
 
 TEST_F(DARTLockTest, LockUnlockDoNothing) {
   using value_t = int;
@@ -234,3 +240,152 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, LockArray) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  // more locks than units to place several tails on each unit
+  const size_t num_locks = 3 * dash::size() + 1;
+  dash::Array<value_t> counters(num_locks);
+  dash::fill(counters.begin(), counters.end(), 0);
+
+  std::vector<dart_lock_t> locks(num_locks);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_array_init(DART_TEAM_ALL, num_locks, locks.data()));
+  // locks of an array cannot be destroyed individually
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_team_lock_destroy(&locks[num_locks - 1]));
+
+  counters.barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    for (size_t l = 0; l < num_locks; ++l) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_acquire(locks[l]));
+      counters[l] = counters[l] + 1;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_release(locks[l]));
+    }
+  }
+  counters.barrier();
+
+  for (size_t l = 0; l < num_locks; ++l) {
+    ASSERT_EQ_U(num_iterations * dash::size(),
+                static_cast<value_t>(counters[l]));
+  }
+
+  // a lock held by one unit cannot be acquired by others
+  int32_t acquired;
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(DART_OK, dart_lock_acquire(locks[1]));
+  }
+  dash::barrier();
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(DART_OK, dart_lock_try_acquire(locks[1], &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(DART_OK, dart_lock_release(locks[1]));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_array_destroy(num_locks, locks.data()));
+  ASSERT_EQ_U(DART_LOCK_NULL, locks[0]);
+
+  // a single-element lock array is not a single lock
+  dart_lock_t single;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_array_init(DART_TEAM_ALL, 1, &single));
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_team_lock_destroy(&single));
+  ASSERT_EQ_U(DART_OK, dart_lock_acquire(single));
+  ASSERT_EQ_U(DART_OK, dart_lock_release(single));
+  dash::barrier();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_array_destroy(1, &single));
+  ASSERT_EQ_U(DART_LOCK_NULL, single);
+}
+
+TEST_F(DARTLockTest, RWLockShared) {
+  dart_rwlock_t lock;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  // all units hold the lock for reading at the same time, this would
+  // deadlock if readers were serialized
+  ASSERT_EQ_U(DART_OK, dart_rwlock_acquire_shared(lock));
+  dash::barrier();
+  int32_t acquired;
+  ASSERT_EQ_U(DART_OK, dart_rwlock_try_acquire(lock, &acquired));
+  ASSERT_EQ_U(0, acquired);
+  dash::barrier();
+  ASSERT_EQ_U(DART_OK, dart_rwlock_release_shared(lock));
+  dash::barrier();
+
+  // a writer excludes readers and other writers
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(DART_OK, dart_rwlock_acquire(lock));
+  }
+  dash::barrier();
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(DART_OK, dart_rwlock_try_acquire_shared(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+    ASSERT_EQ_U(DART_OK, dart_rwlock_try_acquire(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(DART_OK, dart_rwlock_release(lock));
+  }
+  dash::barrier();
+  ASSERT_EQ_U(DART_OK, dart_rwlock_try_acquire_shared(lock, &acquired));
+  ASSERT_EQ_U(1, acquired);
+  ASSERT_EQ_U(DART_OK, dart_rwlock_release_shared(lock));
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, SharedMutexReadWrite) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> first;
+  dash::Shared<value_t> second;
+  dash::SharedMutex mx;
+
+  if (dash::myid() == 0) {
+    first.set(0);
+    second.set(0);
+  }
+  dash::barrier();
+
+  for (int i = 0; i < num_iterations; ++i) {
+    {
+      // writers keep both values equal
+      std::lock_guard<dash::SharedMutex> lg(mx);
+      first.set(first.get() + 1);
+      second.set(second.get() + 1);
+    }
+    {
+      std::shared_lock<dash::SharedMutex> sl(mx);
+      ASSERT_EQ_U(static_cast<value_t>(first.get()),
+                  static_cast<value_t>(second.get()));
+    }
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(),
+              static_cast<value_t>(first.get()));
+}
@@ -4,6 +4,8 @@
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/Array.h>
 
+#include <vector>
+
 TEST_F(DARTMemAllocTest, SmallLocalAlloc)
 {
   typedef int value_t;
@@ -106,6 +108,61 @@ TEST_F(DARTMemAllocTest, LocalAlloc)
     dart_memfree(gptr));
 }
 
+TEST_F(DARTMemAllocTest, LocalAllocGrowth)
+{
+  typedef int value_t;
+  // together exceeding the memory reserved for local allocations
+  const size_t num_allocs = 4;
+  const size_t block_size = (8 * 1024 * 1024) / sizeof(value_t);
+
+  std::vector<dart_gptr_t> gptrs;
+  for (size_t i = 0; i < num_allocs; ++i) {
+    dart_gptr_t gptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(block_size, DART_TYPE_INT, &gptr));
+    ASSERT_NE_U(
+      DART_GPTR_NULL,
+      gptr);
+    value_t *baseptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptr, (void**)&baseptr));
+    baseptr[0]              = dash::myid().id;
+    baseptr[block_size - 1] = i;
+    gptrs.push_back(gptr);
+  }
+
+  dash::Array<dart_gptr_t> arr(dash::size());
+  arr.local[0] = gptrs.back();
+  arr.barrier();
+
+  size_t      neighbor_id = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t neighbor    = arr[neighbor_id];
+  value_t     neighbor_val;
+  dash::dart_storage<value_t> ds(1);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+        &neighbor_val, neighbor, ds.nelem, ds.dtype, ds.dtype));
+  ASSERT_EQ_U(neighbor_id, neighbor_val);
+
+  dart_gptr_incaddr(&neighbor, (block_size - 1) * sizeof(value_t));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+        &neighbor_val, neighbor, ds.nelem, ds.dtype, ds.dtype));
+  ASSERT_EQ_U(num_allocs - 1, neighbor_val);
+
+  arr.barrier();
+
+  for (auto & gptr : gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memfree(gptr));
+  }
+}
+
 
 TEST_F(DARTMemAllocTest, SegmentReuseTest)
 {
@@ -170,6 +227,62 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     dart_team_memfree(gptr2));
 }
 
+TEST_F(DARTMemAllocTest, ManySegmentsTest)
+{
+  // kept below the number of segments MPI implementations typically
+  // allow to attach to a single dynamic window
+  const size_t num_segments = 24;
+  std::vector<dart_gptr_t> gptrs(num_segments);
+
+  auto alloc_segment = [&](size_t i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT, &gptrs[i]));
+    dart_gptr_t gptr = gptrs[i];
+    dart_gptr_setunit(&gptr, dash::Team::All().myid());
+    int *addr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptr, (void**)&addr));
+    *addr = i;
+  };
+
+  for (size_t i = 0; i < num_segments; ++i) {
+    alloc_segment(i);
+  }
+  // release every other segment and allocate it again, the segment IDs
+  // are re-used while the remaining segments stay accessible
+  for (size_t i = 0; i < num_segments; i += 2) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memfree(gptrs[i]));
+  }
+  for (size_t i = 0; i < num_segments; i += 2) {
+    alloc_segment(i);
+  }
+  dash::barrier();
+
+  // read the value at the neighbor from every segment
+  dart_team_unit_t neighbor{
+    static_cast<dart_unit_t>((dash::myid().id + 1) % dash::size())};
+  for (size_t i = 0; i < num_segments; ++i) {
+    dart_gptr_t gptr = gptrs[i];
+    dart_gptr_setunit(&gptr, neighbor);
+    int val;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(&val, gptr, 1, DART_TYPE_INT, DART_TYPE_INT));
+    ASSERT_EQ_U(i, val);
+  }
+  dash::barrier();
+
+  for (auto & gptr : gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memfree(gptr));
+  }
+}
+
 
 TEST_F(DARTMemAllocTest, AllocatorSimpleTest)
 {
@@ -280,6 +280,54 @@ TEST_F(DARTOnesidedTest, StridedPutSimple) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedGetVaryingBlocks) {
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr size_t stride            = 3;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = i;
+  }
+
+  dash::barrier();
+  auto *buf = new int[num_elem_per_unit];
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  dart_datatype_t new_type;
+  dart_type_create_strided(DART_TYPE_INT, stride, 1, &new_type);
+
+  // use more distinct block counts than MPI types are cached per type and
+  // revisit them to exercise both cache hits and replacement
+  for (int rep = 0; rep < 2; ++rep) {
+    for (int nblocks = 1; nblocks <= num_elem_per_unit / stride; nblocks++) {
+      memset(buf, 0, sizeof(int)*num_elem_per_unit);
+      dart_get_blocking(buf, gptr, nblocks, new_type, DART_TYPE_INT);
+      for (int i = 0; i < nblocks; ++i) {
+        ASSERT_EQ_U(i*stride, buf[i]);
+      }
+      ASSERT_EQ_U(0, buf[nblocks]);
+    }
+  }
+
+  dart_type_destroy(&new_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+
+  delete[] buf;
+}
+
+
 TEST_F(DARTOnesidedTest, BlockedStridedToStrided) {
 
   constexpr size_t num_elem_per_unit = 120;
@@ -418,6 +466,66 @@ TEST_F(DARTOnesidedTest, IndexedGetSimple) {
   dart_team_memfree(gptr);
 }
 
+TEST_F(DARTOnesidedTest, IndexedGetRepeated) {
+
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr size_t num_blocks        = 2;
+  constexpr size_t num_repeat        = 3;
+
+  // blocks of 2 and 3 elements at offsets 1 and 7, the extent of the type
+  // is 9 elements
+  std::vector<size_t> blocklens = { 2, 3 };
+  std::vector<size_t> offsets   = { 1, 7 };
+  constexpr size_t extent       = 9;
+  constexpr size_t num_elems    = 5;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = dash::myid() * 1000 + i;
+  }
+
+  dart_datatype_t new_type;
+  dart_type_create_indexed(DART_TYPE_INT, num_blocks, blocklens.data(),
+                           offsets.data(), &new_type);
+
+  dash::barrier();
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  auto *buf = new int[num_elem_per_unit];
+  memset(buf, 0, sizeof(int)*num_elem_per_unit);
+
+  // indexed-to-contig, repeating the type
+  dart_get_blocking(buf, gptr, num_repeat * num_elems,
+                    new_type, DART_TYPE_INT);
+
+  size_t idx = 0;
+  for (size_t r = 0; r < num_repeat; ++r) {
+    for (size_t i = 0; i < num_blocks; ++i) {
+      for (size_t j = 0; j < blocklens[i]; ++j) {
+        ASSERT_EQ_U(neighbor * 1000 + r * extent + offsets[i] + j, buf[idx]);
+        ++idx;
+      }
+    }
+  }
+  ASSERT_EQ_U(0, buf[idx]);
+
+  dart_type_destroy(&new_type);
+
+  dash::barrier();
+
+  delete[] buf;
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+}
+
 TEST_F(DARTOnesidedTest, IndexedPutSimple) {
 
   constexpr size_t num_elem_per_unit = 120;
@@ -596,3 +704,281 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+TEST_F(DARTOnesidedTest, GetVPutV)
+{
+  typedef int value_t;
+  const size_t block_size = 20;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  // read every other element of the array in reverse order
+  std::vector<dart_gptr_t> gptrs;
+  std::vector<size_t>      gidx;
+  for (size_t g = num_elem_total; g > 0; g -= 2) {
+    gptrs.push_back((array.begin() + (g - 1)).dart_gptr());
+    gidx.push_back(g - 1);
+  }
+  std::vector<value_t>   values(gptrs.size(), -1);
+  std::vector<value_t *> dest;
+  for (auto & v : values) {
+    dest.push_back(&v);
+  }
+  dash::internal::getv(gptrs.data(), dest.data(), gptrs.size());
+  for (size_t i = 0; i < gidx.size(); ++i) {
+    value_t expected = ((gidx[i] / block_size) + 1) * 1000
+                       + gidx[i] % block_size;
+    ASSERT_EQ_U(expected, values[i]);
+  }
+  array.barrier();
+
+  // every unit writes its own element in each block of the array
+  std::vector<const value_t *> src;
+  value_t newval = dash::myid();
+  gptrs.clear();
+  for (size_t u = 0; u < dash::size(); ++u) {
+    gptrs.push_back(
+      (array.begin() + (u * block_size + dash::myid().id)).dart_gptr());
+    src.push_back(&newval);
+  }
+  if (dash::size() <= block_size) {
+    dash::internal::putv(gptrs.data(), src.data(), gptrs.size());
+  }
+  array.barrier();
+
+  if (dash::size() <= block_size) {
+    for (size_t u = 0; u < dash::size(); ++u) {
+      ASSERT_EQ_U(u, array.local[u]);
+    }
+  }
+}
+
+TEST_F(DARTOnesidedTest, GetVPutVStruct)
+{
+  // transferred as DART_TYPE_BYTE with nelem = sizeof(value_t)
+  struct value_t {
+    int a;
+    int b;
+    int c;
+  };
+  const size_t block_size = 48;
+  const size_t stride     = sizeof(value_t);
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    int v = ((dash::myid() + 1) * 1000) + l;
+    array.local[l] = value_t { v, -v, v * 2 };
+  }
+  array.barrier();
+
+  // read every stride-th element from the right neighbor's block
+  auto right = (dash::myid() + 1) % dash::size();
+  std::vector<dart_gptr_t> gptrs;
+  std::vector<size_t>      gidx;
+  for (size_t l = 0; l < block_size; l += stride) {
+    gptrs.push_back((array.begin() + (right * block_size + l)).dart_gptr());
+    gidx.push_back(right * block_size + l);
+  }
+  std::vector<value_t>   values(gptrs.size(), value_t { -1, -1, -1 });
+  std::vector<value_t *> dest;
+  for (auto & v : values) {
+    dest.push_back(&v);
+  }
+  dash::internal::getv(gptrs.data(), dest.data(), gptrs.size());
+  for (size_t i = 0; i < gidx.size(); ++i) {
+    int expected = ((gidx[i] / block_size) + 1) * 1000
+                   + gidx[i] % block_size;
+    ASSERT_EQ_U(expected,     values[i].a);
+    ASSERT_EQ_U(-expected,    values[i].b);
+    ASSERT_EQ_U(expected * 2, values[i].c);
+  }
+  array.barrier();
+
+  // overwrite the right neighbor's block, all targets are contiguous
+  std::vector<value_t>         newvals(block_size);
+  std::vector<const value_t *> src;
+  gptrs.clear();
+  for (size_t l = 0; l < block_size; ++l) {
+    int v = (dash::myid() * 1000) + l;
+    newvals[l] = value_t { v, v + 1, v + 2 };
+    gptrs.push_back((array.begin() + (right * block_size + l)).dart_gptr());
+    src.push_back(&newvals[l]);
+  }
+  dash::internal::putv(gptrs.data(), src.data(), gptrs.size());
+  array.barrier();
+
+  auto left = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t l = 0; l < block_size; ++l) {
+    int expected = (left * 1000) + l;
+    value_t v = array.local[l];
+    ASSERT_EQ_U(expected,     v.a);
+    ASSERT_EQ_U(expected + 1, v.b);
+    ASSERT_EQ_U(expected + 2, v.c);
+  }
+}
+
+TEST_F(DARTOnesidedTest, PutNotify)
+{
+  typedef int value_t;
+  const size_t block_size = 1000;
+  const int    rounds     = 3;
+  dash::Array<value_t> array(dash::size() * block_size, dash::BLOCKED);
+  dash::Array<int64_t> counter(dash::size(), dash::BLOCKED);
+  counter.local[0] = 0;
+  counter.barrier();
+
+  auto myid  = dash::myid().id;
+  auto right = (myid + 1) % dash::size();
+  auto left  = (myid + dash::size() - 1) % dash::size();
+  std::vector<value_t> buf(block_size);
+  for (int r = 0; r < rounds; ++r) {
+    for (size_t l = 0; l < block_size; ++l) {
+      buf[l] = (myid * 100000) + (r * 10000) + l;
+    }
+    // signal the right neighbor once its block has been written
+    dash::internal::put_notify(
+      (array.begin() + (right * block_size)).dart_gptr(),
+      buf.data(), block_size,
+      (counter.begin() + right).dart_gptr());
+    // wait for the left neighbor's payload, no barrier required
+    dash::internal::notify_wait(
+      (counter.begin() + myid).dart_gptr(), r + 1);
+    for (size_t l = 0; l < block_size; ++l) {
+      ASSERT_EQ_U((left * 100000) + (r * 10000) + l, array.local[l]);
+    }
+    // do not overwrite the block before it has been checked
+    array.barrier();
+  }
+  ASSERT_EQ_U(rounds, counter.local[0]);
+}
+
+TEST_F(DARTOnesidedTest, HandleGroup)
+{
+  typedef int value_t;
+  const size_t block_size = 1000;
+  const int    rounds     = 3;
+  dash::Array<value_t> array(dash::size() * block_size, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = (dash::myid() * 10000) + l;
+  }
+  array.barrier();
+
+  dart_handle_group_t group;
+  ASSERT_EQ_U(DART_OK, dart_handle_group_create(dash::size(), &group));
+  std::vector<value_t> local_copy(array.size());
+  // the group is empty after completion and can be reused
+  for (int r = 0; r < rounds; ++r) {
+    std::fill(local_copy.begin(), local_copy.end(), -1);
+    for (size_t u = 0; u < dash::size(); ++u) {
+      auto offset = u * block_size;
+      if (u % 2) {
+        // mix in operations started through a handle
+        dart_handle_t handle;
+        dash::internal::get_handle(
+          (array.begin() + offset).dart_gptr(),
+          local_copy.data() + offset, block_size, &handle);
+        ASSERT_EQ_U(DART_OK, dart_handle_group_add(group, &handle));
+        ASSERT_EQ_U(DART_HANDLE_NULL, handle);
+      } else {
+        dash::internal::get_group(
+          (array.begin() + offset).dart_gptr(),
+          local_copy.data() + offset, block_size, group);
+      }
+    }
+    if (r % 2) {
+      int32_t flag = 0;
+      while (!flag) {
+        ASSERT_EQ_U(DART_OK, dart_handle_group_test_local(group, &flag));
+      }
+    } else {
+      ASSERT_EQ_U(DART_OK, dart_handle_group_wait_local(group));
+    }
+    for (size_t g = 0; g < array.size(); ++g) {
+      ASSERT_EQ_U(
+        ((g / block_size) * 10000) + (g % block_size), local_copy[g]);
+    }
+  }
+  array.barrier();
+
+  // write the local block to the right neighbor
+  auto right = (dash::myid() + 1) % dash::size();
+  std::vector<value_t> buf(block_size);
+  for (size_t l = 0; l < block_size; ++l) {
+    buf[l] = (dash::myid() * 10000) + block_size + l;
+  }
+  dash::internal::put_group(
+    (array.begin() + (right * block_size)).dart_gptr(),
+    buf.data(), block_size, group);
+  ASSERT_EQ_U(DART_OK, dart_handle_group_wait(group));
+  array.barrier();
+  auto left = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t l = 0; l < block_size; ++l) {
+    ASSERT_EQ_U((left * 10000) + block_size + l, array.local[l]);
+  }
+
+  ASSERT_EQ_U(DART_OK, dart_handle_group_destroy(&group));
+  ASSERT_EQ_U(DART_HANDLE_GROUP_NULL, group);
+}
+
+TEST_F(DARTOnesidedTest, ShmemAtomics)
+{
+  typedef int64_t value_t;
+  const int rounds = 10;
+  dash::Array<value_t> array(dash::size() * 2, dash::BLOCKED);
+  array.local[0] = 0;
+  array.local[1] = 0;
+
+  dart_gptr_t gptr = array.begin().dart_gptr();
+  ASSERT_EQ_U(DART_OK, dart_gptr_setflags(&gptr, DART_GPTR_FLAG_SHMEM_ATOMICS));
+  uint16_t flags;
+  ASSERT_EQ_U(DART_OK, dart_gptr_getflags(gptr, &flags));
+  ASSERT_EQ_U(DART_GPTR_FLAG_SHMEM_ATOMICS, flags);
+  array.barrier();
+
+  value_t one  = 1;
+  value_t myid = dash::myid();
+  for (int r = 0; r < rounds; ++r) {
+    for (size_t u = 0; u < dash::size(); ++u) {
+      auto counter = (array.begin() + (u * 2)).dart_gptr();
+      value_t prev;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_fetch_and_op(
+          counter, &one, &prev, DART_TYPE_LONGLONG, DART_OP_SUM));
+      ASSERT_LT_U(prev, static_cast<value_t>(dash::size() * rounds));
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_accumulate(
+          (array.begin() + (u * 2) + 1).dart_gptr(),
+          &myid, 1, DART_TYPE_LONGLONG, DART_OP_MAX));
+      ASSERT_EQ_U(DART_OK, dart_flush(counter));
+    }
+  }
+  array.barrier();
+  ASSERT_EQ_U(dash::size() * rounds, array.local[0]);
+  ASSERT_EQ_U(dash::size() - 1, array.local[1]);
+  array.local[0] = 0;
+  array.barrier();
+
+  // exactly one unit succeeds in swapping in its ID
+  value_t compare = 0;
+  value_t desired = myid + 1;
+  value_t result;
+  auto target = array.begin().dart_gptr();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_compare_and_swap(
+      target, &desired, &compare, &result, DART_TYPE_LONGLONG));
+  ASSERT_EQ_U(DART_OK, dart_flush(target));
+  array.barrier();
+  value_t winner = array[0];
+  ASSERT_GT_U(winner, 0);
+  if (result == 0) {
+    ASSERT_EQ_U(desired, winner);
+  } else {
+    ASSERT_EQ_U(winner, result);
+  }
+}
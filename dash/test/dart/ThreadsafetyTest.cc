@@ -15,6 +15,10 @@
 
 #include <mpi.h>
 
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
 #if defined(DASH_ENABLE_OPENMP)
 #include <omp.h>
 #endif
@@ -374,4 +378,70 @@ TEST_F(ThreadsafetyTest, ConcurrentAlgorithm) {
 #endif // !defined(DASH_ENABLE_OPENMP)
 }
 
+/**
+ * Number of threads of the calling process, 0 if unknown.
+ */
+static int num_process_threads() {
+  int num_threads = 0;
+  std::ifstream status("/proc/self/status");
+  std::string   line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 8, "Threads:") == 0) {
+      num_threads = std::stoi(line.substr(8));
+    }
+  }
+  return num_threads;
+}
+
+TEST_F(ThreadsafetyTest, ProgressThread) {
+  if (!dash::is_multithreaded()) {
+    SKIP_TEST_MSG("requires support for multi-threading");
+  }
+
+  // restart DART with the progress thread enabled
+  dash::finalize();
+  int num_threads = num_process_threads();
+  setenv("DART_PROGRESS_THREAD", "1", 1);
+  dart_thread_support_level_t provided;
+  ASSERT_EQ_U(
+    DART_OK, dart_init_thread(&TESTENV::argc, &TESTENV::argv, &provided));
+  unsetenv("DART_PROGRESS_THREAD");
+  ASSERT_EQ_U(DART_THREAD_MULTIPLE, provided);
+  if (num_threads > 0) {
+    EXPECT_EQ_U(num_threads + 1, num_process_threads());
+  }
+
+  // communicate while the progress thread is running
+  dart_global_unit_t myid;
+  size_t             nunits;
+  dart_myid(&myid);
+  dart_size(&nunits);
+  dart_gptr_t gptr;
+  int       * lptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT, &gptr));
+  gptr.unitid = myid.id;
+  dart_gptr_getaddr(gptr, reinterpret_cast<void **>(&lptr));
+  *lptr = -1;
+  dart_barrier(DART_TEAM_ALL);
+  int value   = myid.id;
+  gptr.unitid = (myid.id + 1) % nunits;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_blocking(gptr, &value, 1, DART_TYPE_INT, DART_TYPE_INT));
+  dart_barrier(DART_TEAM_ALL);
+  EXPECT_EQ_U((myid.id + nunits - 1) % nunits, *lptr);
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+
+  // the progress thread is stopped by dart_exit
+  ASSERT_EQ_U(DART_OK, dart_exit());
+  if (num_threads > 0) {
+    EXPECT_EQ_U(num_threads, num_process_threads());
+  }
+
+  dash::init(&TESTENV::argc, &TESTENV::argv);
+}
+
 #endif // DASH_ENABLE_THREADSUPPORT
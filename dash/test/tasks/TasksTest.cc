@@ -0,0 +1,118 @@
+
+#include "TasksTest.h"
+
+#include <dash/Tasks.h>
+#include <dash/Array.h>
+#include <dash/util/Config.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+
+TEST_F(TasksTest, Dependencies)
+{
+  dash::util::Config::set("DASH_NUM_THREADS", 3);
+
+  const int num_tasks = 20;
+  dash::Array<int> arr(_dash_size * 4);
+  auto lbegin = arr.begin() + _dash_id * 4;
+  auto lend   = lbegin + 4;
+
+  std::mutex       mutex;
+  std::vector<int> order;
+
+  // tasks writing to the same range are executed in creation order
+  for (int i = 0; i < num_tasks; ++i) {
+    dash::tasks::async(
+      [&, i]() {
+        std::lock_guard<std::mutex> lg(mutex);
+        order.push_back(i);
+        arr.local[i % 4] = i;
+      },
+      dash::tasks::out(lbegin, lend));
+  }
+  // readers see the values of all writers created before
+  std::vector<dash::Future<int>> futs;
+  for (int i = 0; i < 4; ++i) {
+    futs.push_back(dash::tasks::async(
+      [&, i]() { return static_cast<int>(arr.local[i]); },
+      dash::tasks::in(lbegin + i)));
+  }
+  // writer to a disjoint range does not wait for other tasks
+  dash::tasks::async(
+    []() { },
+    dash::tasks::out(lend, lend + 1));
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ_U(num_tasks - 4 + i, futs[i].get());
+  }
+  dash::tasks::complete();
+
+  ASSERT_EQ_U(num_tasks, order.size());
+  for (int i = 0; i < num_tasks; ++i) {
+    ASSERT_EQ_U(i, order[i]);
+  }
+}
+
+TEST_F(TasksTest, WorkStealing)
+{
+  dash::util::Config::set("DASH_NUM_THREADS", 4);
+  ASSERT_EQ_U(4, dash::tasks::num_threads());
+
+  const int        num_tasks = 1000;
+  std::atomic<int> count(0);
+  std::vector<dash::Future<int>> futs;
+  for (int i = 0; i < num_tasks; ++i) {
+    futs.push_back(dash::tasks::async(
+      [&count, i]() {
+        ++count;
+        return i;
+      }));
+  }
+  dash::when_all(futs.begin(), futs.end()).wait();
+  for (int i = 0; i < num_tasks; ++i) {
+    ASSERT_EQ_U(i, futs[i].get());
+  }
+  ASSERT_EQ_U(num_tasks, count.load());
+  dash::tasks::complete();
+}
+
+namespace {
+
+struct RemoteTaskArg {
+  dart_unit_t origin;
+  int         round;
+};
+
+std::atomic<int> remote_task_sum;
+
+void remote_task(const RemoteTaskArg & arg)
+{
+  remote_task_sum += arg.origin + 1;
+  // forward to the next unit until every unit executed the task once
+  if (arg.round + 1 < static_cast<int>(dash::size())) {
+    RemoteTaskArg next { arg.origin, arg.round + 1 };
+    dash::tasks::async_at(
+      dash::global_unit_t((dash::myid() + 1) % dash::size()),
+      &remote_task, next);
+  }
+}
+
+} // namespace
+
+TEST_F(TasksTest, RemoteTasks)
+{
+  dash::util::Config::set("DASH_NUM_THREADS", 2);
+  remote_task_sum = 0;
+  dash::tasks::register_remote(&remote_task);
+
+  RemoteTaskArg arg { static_cast<dart_unit_t>(_dash_id), 0 };
+  dash::tasks::async_at(
+    dash::global_unit_t((_dash_id + 1) % _dash_size), &remote_task, arg);
+  dash::tasks::complete();
+
+  // every unit executed the task of every unit once
+  int expected = (_dash_size * (_dash_size + 1)) / 2;
+  ASSERT_EQ_U(expected, remote_task_sum.load());
+}
@@ -0,0 +1,29 @@
+#ifndef DASH__TEST__TASKS_TEST_H_
+#define DASH__TEST__TASKS_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for \c dash::tasks.
+ */
+class TasksTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id;
+  size_t _dash_size;
+
+  TasksTest()
+  : _dash_id(0),
+    _dash_size(0) {
+  }
+
+  virtual ~TasksTest() {
+  }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+};
+
+#endif // DASH__TEST__TASKS_TEST_H_
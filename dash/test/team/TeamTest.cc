@@ -34,6 +34,25 @@ TEST_F(TeamTest, Deallocate) {
   // Array will be deallocated when going out of scope
 }
 
+TEST_F(TeamTest, BarrierAsync) {
+  auto & team = dash::Team::All();
+
+  auto fut = team.barrier_async();
+  // overlap local work with the barrier
+  volatile int work = 0;
+  for (int i = 0; i < 1000; ++i) {
+    work += i;
+  }
+  while (!fut.test()) { }
+  fut.get();
+
+  // futures complete the barrier on destruction
+  {
+    auto fut_unused = team.barrier_async();
+  }
+  team.barrier();
+}
+
 TEST_F(TeamTest, SplitTeamSync)
 {
   auto & team_all = dash::Team::All();
@@ -106,3 +125,59 @@ TEST_F(TeamTest, SplitTeamSync)
   }
 }
 
+
+TEST_F(TeamTest, UnitIdTranslation)
+{
+  if (dash::size() < 3) {
+    SKIP_TEST_MSG("requires at least 3 units");
+  }
+
+  // team of all units with even global ID
+  dart_group_t group;
+  ASSERT_EQ_U(DART_OK, dart_group_create(&group));
+  for (size_t u = 0; u < dash::size(); u += 2) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_group_addmember(group, dash::global_unit_t(u)));
+  }
+  dart_team_t team;
+  ASSERT_EQ_U(DART_OK, dart_team_create(DART_TEAM_ALL, group, &team));
+  ASSERT_EQ_U(DART_OK, dart_group_destroy(&group));
+
+  if (dash::myid().id % 2 != 0) {
+    ASSERT_EQ_U(DART_TEAM_NULL, team);
+    return;
+  }
+
+  size_t team_size;
+  ASSERT_EQ_U(DART_OK, dart_team_size(team, &team_size));
+  ASSERT_EQ_U((dash::size() + 1) / 2, team_size);
+
+  for (size_t u = 0; u < team_size; ++u) {
+    dart_global_unit_t gid;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_unit_l2g(team, dash::team_unit_t(u), &gid));
+    ASSERT_EQ_U(2 * u, gid.id);
+
+    dart_team_unit_t lid;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_unit_g2l(team, gid, &lid));
+    ASSERT_EQ_U(u, lid.id);
+  }
+
+  // units not in the team
+  dart_team_unit_t lid;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_unit_g2l(team, dash::global_unit_t(1), &lid));
+  ASSERT_EQ_U(DART_UNDEFINED_UNIT_ID, lid.id);
+
+  dart_global_unit_t gid;
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_team_unit_l2g(team, dash::team_unit_t(team_size), &gid));
+
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
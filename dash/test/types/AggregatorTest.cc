@@ -0,0 +1,100 @@
+
+#include <gtest/gtest.h>
+
+#include <dash/Aggregator.h>
+#include <dash/Array.h>
+
+#include <dash/algorithm/Fill.h>
+
+#include "../TestBase.h"
+#include "AggregatorTest.h"
+
+#include <vector>
+#include <cstdint>
+
+
+TEST_F(AggregatorTest, AddUpdates)
+{
+  typedef int64_t value_t;
+
+  const size_t elem_per_unit = 100;
+  const size_t num_updates   = 5000;
+  dash::Array<value_t> array(elem_per_unit * dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  {
+    // small threshold to ship batches before the final flush
+    dash::Aggregator<value_t, dash::plus<value_t>> agg(array, 64);
+    for (size_t i = 0; i < num_updates; ++i) {
+      agg.update((i * 7) % array.size(), i % 3);
+    }
+    agg.flush();
+  }
+  array.barrier();
+
+  if (dash::myid() == 0) {
+    std::vector<value_t> expected(array.size(), 0);
+    for (size_t i = 0; i < num_updates; ++i) {
+      expected[(i * 7) % array.size()] += (i % 3) * dash::size();
+    }
+    for (size_t g = 0; g < array.size(); ++g) {
+      EXPECT_EQ_U(expected[g], static_cast<value_t>(array[g]));
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(AggregatorTest, XorUpdates)
+{
+  typedef uint64_t value_t;
+
+  const size_t elem_per_unit = 256;
+  dash::Array<value_t> array(elem_per_unit * dash::size());
+  for (size_t l = 0; l < array.local.size(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  // applying the same random updates twice restores the initial values
+  dash::Aggregator<value_t, dash::bit_xor<value_t>> agg(array);
+  for (int rep = 0; rep < 2; ++rep) {
+    value_t ran = dash::myid().id + 1;
+    for (size_t i = 0; i < 4 * array.size(); ++i) {
+      ran = (ran << 1) ^ ((static_cast<int64_t>(ran) < 0) ? 7 : 0);
+      agg.update(ran % array.size(), ran);
+    }
+    agg.flush();
+    array.barrier();
+    if (rep == 0) {
+      continue;
+    }
+    for (size_t l = 0; l < array.local.size(); ++l) {
+      EXPECT_EQ_U(array.pattern().global(l), array.local[l]);
+    }
+  }
+}
+
+TEST_F(AggregatorTest, ReplaceInOrder)
+{
+  typedef int value_t;
+
+  dash::Array<value_t> array(dash::size());
+  array.local[0] = -1;
+  array.barrier();
+
+  {
+    dash::Aggregator<value_t, dash::second<value_t>> agg(array);
+    if (dash::myid() == 0) {
+      for (int r = 0; r < 10; ++r) {
+        for (size_t u = 0; u < dash::size(); ++u) {
+          agg.update(u, r * 100 + u);
+        }
+      }
+    }
+    // destructor flushes
+  }
+  array.barrier();
+
+  ASSERT_EQ_U(900 + dash::myid().id, array.local[0]);
+}
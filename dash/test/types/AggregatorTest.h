@@ -0,0 +1,13 @@
+#ifndef DASH__TEST__AGGREGATOR_TEST_H__INCLUDED
+#define DASH__TEST__AGGREGATOR_TEST_H__INCLUDED
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for class dash::Aggregator
+ */
+class AggregatorTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__AGGREGATOR_TEST_H__INCLUDED
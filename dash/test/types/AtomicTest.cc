@@ -553,6 +553,51 @@ TEST_F(AtomicTest, AtomicSignal){
 }
 
 
+TEST_F(AtomicTest, AsyncDeferredOps){
+  using value_t = int64_t;
+  using atom_t  = dash::Atomic<value_t>;
+  using array_t = dash::Array<atom_t>;
+
+  // more updates than value slots are buffered in DART
+  const int    num_updates = 5000;
+  const size_t num_bins    = dash::size() * 4;
+  array_t histo(num_bins);
+  dash::fill(histo.begin(), histo.end(), 0);
+  histo.barrier();
+
+  for (int i = 0; i < num_updates; ++i) {
+    histo.async[(i + dash::myid()) % num_bins].add(1);
+  }
+  // completed by the barrier
+  histo.barrier();
+
+  value_t total = 0;
+  for (size_t b = 0; b < num_bins; ++b) {
+    value_t expected = 0;
+    for (size_t u = 0; u < dash::size(); ++u) {
+      for (int i = 0; i < num_updates; ++i) {
+        if ((i + u) % num_bins == b) {
+          ++expected;
+        }
+      }
+    }
+    ASSERT_EQ_U(expected, histo[b].get());
+    total += histo[b].get();
+  }
+  ASSERT_EQ_U(num_updates * dash::size(), total);
+  histo.barrier();
+
+  // updates of the same value are applied in order
+  if (dash::myid() == 0) {
+    for (int i = 0; i < num_updates; ++i) {
+      histo.async[dash::size() - 1].set(i);
+    }
+    histo.async[dash::size() - 1].flush();
+    ASSERT_EQ_U(num_updates - 1, histo[dash::size() - 1].get());
+  }
+  histo.barrier();
+}
+
 TEST_F(AtomicTest, ElementCompare){
   using value_t = int;
   using atom_t  = dash::Atomic<value_t>;
@@ -5,6 +5,9 @@
 
 #include <dash/Future.h>
 
+#include <array>
+#include <vector>
+
 
 TEST_F(FutureTest, DefaultCtor)
 {
@@ -97,3 +100,95 @@ TEST_F(FutureTest, VoidFunc)
   ASSERT_EQ_U(true, test_called);
   ASSERT_EQ_U(true, destructor_called);
 }
+
+TEST_F(FutureTest, ThenChain)
+{
+  int  value  = 42;
+  bool called = false;
+
+  // first test returns false, second test provides the value
+  int  num_tests = 0;
+  dash::Future<int> fut(
+    [=](){ return value; },
+    [=, &num_tests](int *val){
+      if (num_tests++ == 0) {
+        return false;
+      }
+      *val = value;
+      return true;
+    });
+
+  auto fut_void = fut.then([&](int val) { called = (val == value); })
+                     .then([&]() { return 2.0 * value; });
+
+  ASSERT_EQ_U(false, fut_void.test());
+  ASSERT_EQ_U(false, called);
+  ASSERT_EQ_U(true, fut_void.test());
+  ASSERT_EQ_U(true, called);
+  ASSERT_EQ_U(2.0 * value, fut_void.get());
+}
+
+TEST_F(FutureTest, WhenAll)
+{
+  bool ready = false;
+  dash::Future<int>  fut_int([]() { return 42; },
+                             [&](int *val) { *val = 42; return ready; });
+  dash::Future<void> fut_void([]() { },
+                              [&]() { return true; });
+
+  auto fut_all = dash::when_all(fut_int, fut_void);
+  ASSERT_EQ_U(false, fut_all.test());
+  ASSERT_EQ_U(true,  fut_void.test());
+  ready = true;
+  ASSERT_EQ_U(true,  fut_all.test());
+  ASSERT_EQ_U(42,    fut_int.get());
+
+  std::vector<dash::Future<int>> futs;
+  for (int i = 0; i < 4; ++i) {
+    futs.emplace_back([=]() { return i; });
+  }
+  dash::when_all(futs.begin(), futs.end()).wait();
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ_U(i, futs[i].get());
+  }
+}
+
+TEST_F(FutureTest, WhenAny)
+{
+  dash::Future<int>  fut_int([]() { return 42; },
+                             [](int *) { return false; });
+  dash::Future<void> fut_void([]() { },
+                              []() { return true; });
+
+  auto fut_any = dash::when_any(fut_int, fut_void);
+  ASSERT_EQ_U(true, fut_any.test());
+  ASSERT_EQ_U(1,    fut_any.get());
+
+  std::vector<dash::Future<int>> futs;
+  for (int i = 0; i < 4; ++i) {
+    futs.emplace_back([=]() { return i; },
+                      [=](int *val) { *val = i; return i == 2; });
+  }
+  ASSERT_EQ_U(2, dash::when_any(futs.begin(), futs.end()).get());
+}
+
+TEST_F(FutureTest, SmallFunction)
+{
+  // small callables are stored in place, large callables on the heap
+  std::array<char, 256> large{};
+  large[0] = 1;
+  int small = 2;
+  dash::internal::SmallFunction<int(void)> small_func(
+    [=]() { return small; });
+  dash::internal::SmallFunction<int(void)> large_func(
+    [=]() { return static_cast<int>(large[0]); });
+
+  auto moved_func = std::move(large_func);
+  ASSERT_EQ_U(false, static_cast<bool>(large_func));
+  ASSERT_EQ_U(1, moved_func());
+  ASSERT_EQ_U(2, small_func());
+
+  std::function<int(void)> empty;
+  dash::internal::SmallFunction<int(void)> empty_func(empty);
+  ASSERT_EQ_U(false, static_cast<bool>(empty_func));
+}